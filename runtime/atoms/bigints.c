@@ -19,6 +19,7 @@
 // 3. This notice may not be removed or altered from any source distribution.
 
 #include "bigints.h"
+#include "../dispatch.h"
 #include "../macros.h"
 #include "../buffer.h"
 #include "numbers.h"
@@ -747,26 +748,33 @@ static value_t Bigint_Denominator( PREFUNC, value_t value )
 	return num_one;
 }
 
+static const struct method_table Bigint_methods = {
+	(function_t)Bigint_function,
+	{
+		METHOD_ENTRY(compare_to, Bigint_Compare_to),
+		METHOD_ENTRY(add, Bigint_Add),
+		METHOD_ENTRY(subtract, Bigint_Subtract),
+		METHOD_ENTRY(multiply, Bigint_Multiply),
+		METHOD_ENTRY(divide, Bigint_Divide),
+		METHOD_ENTRY(modulus, Bigint_Modulus),
+		METHOD_ENTRY(shift_left, Bigint_ShiftLeft),
+		METHOD_ENTRY(shift_right, Bigint_ShiftRight),
+		METHOD_ENTRY(bit_and, Bigint_BitAnd),
+		METHOD_ENTRY(bit_or, Bigint_BitOr),
+		METHOD_ENTRY(bit_xor, Bigint_BitXor),
+		METHOD_ENTRY(numerator, Bigint_Numerator),
+		METHOD_ENTRY(denominator, Bigint_Denominator),
+		METHOD_CLOSURE(is_number, &True_returner),
+		METHOD_CLOSURE(is_rational, &True_returner),
+		METHOD_CLOSURE(is_integer, &True_returner),
+	}
+};
+
 static value_t Bigint_function( PREFUNC, value_t selector )
 {
     ARGCHECK_1( selector );
-	DEFINE_METHOD(compare_to, Bigint_Compare_to)
-	DEFINE_METHOD(add, Bigint_Add)
-	DEFINE_METHOD(subtract, Bigint_Subtract)
-	DEFINE_METHOD(multiply, Bigint_Multiply)
-	DEFINE_METHOD(divide, Bigint_Divide)
-	DEFINE_METHOD(modulus, Bigint_Modulus)
+	DISPATCH_METHODS( Bigint_methods );
 //	DEFINE_METHOD(exponentiate, Bigint_Exponentiate)
-	DEFINE_METHOD(shift_left, Bigint_ShiftLeft)
-	DEFINE_METHOD(shift_right, Bigint_ShiftRight)
-	DEFINE_METHOD(bit_and, Bigint_BitAnd)
-	DEFINE_METHOD(bit_or, Bigint_BitOr)
-	DEFINE_METHOD(bit_xor, Bigint_BitXor)
-	DEFINE_METHOD(numerator, Bigint_Numerator)
-	DEFINE_METHOD(denominator, Bigint_Denominator)
-	if (selector == sym_is_number) return &True_returner;
-	if (selector == sym_is_rational) return &True_returner;
-	if (selector == sym_is_integer) return &True_returner;
 	return ThrowMemberNotFound( zone, selector );
 }
 
@@ -791,6 +799,48 @@ double DoubleFromBigint( value_t exp )
 	return negative ? -out : out;
 }
 
+// BigintFromSize
+//
+// Make a bigint holding the length of something in memory, which may be too
+// large for a fixint. Callers outside this module should use NumberFromSize,
+// which returns a fixint whenever the value fits in one.
+//
+value_t BigintFromSize( zone_t zone, size_t value )
+{
+	uint64_t wide = value;
+	digit_t digits[3];
+	digits[0] = (digit_t)(wide << 1);
+	digits[1] = (digit_t)(wide >> 31);
+	digits[2] = (digit_t)(wide >> 63);
+	unsigned count = digits[2] ? 3 : digits[1] ? 2 : 1;
+	function_t func = (function_t)Bigint_function;
+	return (value_t)clone_buffer( zone, func, count * sizeof(digit_t), digits );
+}
+
+// SizeFromBigint
+//
+// Read a bigint back out as a size_t. Values outside the range of a size_t
+// are clamped to zero or to SIZE_MAX, and we return false to say so.
+//
+bool SizeFromBigint( value_t exp, size_t *out )
+{
+	assert( IsABigint( exp ) );
+	if (NEGATIVE( exp )) {
+		*out = 0;
+		return false;
+	}
+	unsigned size = count_sig_digits( exp );
+	uint64_t value = get_digit( 0, size, exp ) >> 1;
+	value |= (uint64_t)get_digit( 1, size, exp ) << 31;
+	value |= (uint64_t)get_digit( 2, size, exp ) << 63;
+	if (size > 3 || get_digit( 2, size, exp ) > 1 || value > SIZE_MAX) {
+		*out = SIZE_MAX;
+		return false;
+	}
+	*out = (size_t)value;
+	return true;
+}
+
 // BigintQuotient
 //
 // Divide these bigints and return the quotient, ignoring the remainder.
@@ -1202,6 +1252,37 @@ static void test_longdiv( zone_t zone )
 
 }
 
+static void test_sizes( zone_t zone )
+{
+	// Sizes which fit in a fixint come back as fixints.
+	value_t sA = NumberFromSize( zone, 0x7FFFFFFF );
+	assert( IsAFixint( sA ) );
+	// Anything larger is a bigint, whose value must survive the trip back,
+	// and must compare properly with the other numbers.
+	size_t big = (size_t)0x80000000 + 5;
+	value_t sB = NumberFromSize( zone, big );
+	assert( IsABigint( sB ) );
+	assert_greater( zone, sB, sA );
+	size_t out = 0;
+	assert( SizeFromNumber( sB, &out ) && out == big );
+	value_t sC = METHOD_1( sA, sym_add, NumberFromInt( zone, 6 ) );
+	assert_equal( zone, sB, sC );
+	if (sizeof(size_t) > 4) {
+		size_t huge = ~(size_t)0 - 1;
+		value_t sD = NumberFromSize( zone, huge );
+		assert( SizeFromNumber( sD, &out ) && out == huge );
+		// One beyond the largest size is out of range and clamps.
+		value_t sE = METHOD_1( NumberFromSize( zone, ~(size_t)0 ),
+				sym_add, num_one );
+		assert( !SizeFromNumber( sE, &out ) && out == ~(size_t)0 );
+	}
+	// Negative numbers are no sizes, but clamp to zero in a slice.
+	value_t sF = METHOD_1( num_zero, sym_subtract, sB );
+	assert( !SizeFromNumber( sF, &out ) );
+	assert( ClampedSizeFromNumber( sF, &out ) && 0 == out );
+	assert( !SizeFromNumber( NumberFromInt( zone, -1 ), &out ) );
+}
+
 void test_bigints( zone_t zone )
 {
 	fprintf( stderr, "bigint tests begin:\n" );
@@ -1214,6 +1295,7 @@ void test_bigints( zone_t zone )
 	test_umul();
 	test_multiply( zone );
 	test_longdiv( zone );
+	test_sizes( zone );
 	fprintf( stderr, "...bigint tests done\n" );
 }
 
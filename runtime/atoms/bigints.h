@@ -30,6 +30,8 @@ void init_bigints( zone_t zone );
 bool IsABigint( value_t exp );
 double DoubleFromBigint( value_t exp );
 value_t BigintQuotient( zone_t zone, value_t numer, value_t denom );
+value_t BigintFromSize( zone_t zone, size_t value );
+bool SizeFromBigint( value_t exp, size_t *out );
 
 // Don't do this generally: we assume that bigints are always bigger than
 // fixints, that any number which can be represented by a fixint will be.
@@ -32,11 +32,14 @@
 #include "relations.h"
 #include "rationals.h"
 #include "floats.h"
+#include "dispatch.h"
 #include "macros.h"
 #include "bigints.h"
 #include <limits.h>
 
 
+static value_t Fixint_function( PREFUNC, value_t selector );
+
 static value_t NotAnInteger( zone_t zone )
 {
 	return ThrowCStr( zone, "non-integer operand in an integer operation" );
@@ -284,26 +287,33 @@ static value_t Fixint_Denominator( PREFUNC, value_t number )
 	return num_one;
 }
 
+static const struct method_table Fixint_methods = {
+	(function_t)Fixint_function,
+	{
+		METHOD_ENTRY(compare_to, Fixint_Compare_to),
+		METHOD_ENTRY(add, Fixint_Add),
+		METHOD_ENTRY(subtract, Fixint_Subtract),
+		METHOD_ENTRY(multiply, Fixint_Multiply),
+		METHOD_ENTRY(divide, Fixint_Divide),
+		METHOD_ENTRY(modulus, Fixint_Modulus),
+		METHOD_ENTRY(exponentiate, Fixint_Exponentiate),
+		METHOD_ENTRY(shift_left, Fixint_ShiftLeft),
+		METHOD_ENTRY(shift_right, Fixint_ShiftRight),
+		METHOD_ENTRY(bit_and, Fixint_BitAnd),
+		METHOD_ENTRY(bit_or, Fixint_BitOr),
+		METHOD_ENTRY(bit_xor, Fixint_BitXor),
+		METHOD_ENTRY(numerator, Fixint_Numerator),
+		METHOD_ENTRY(denominator, Fixint_Denominator),
+		METHOD_CLOSURE(is_number, &True_returner),
+		METHOD_CLOSURE(is_rational, &True_returner),
+		METHOD_CLOSURE(is_integer, &True_returner),
+	}
+};
+
 static value_t Fixint_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(compare_to, Fixint_Compare_to)
-	DEFINE_METHOD(add, Fixint_Add)
-	DEFINE_METHOD(subtract, Fixint_Subtract)
-	DEFINE_METHOD(multiply, Fixint_Multiply)
-	DEFINE_METHOD(divide, Fixint_Divide)
-	DEFINE_METHOD(modulus, Fixint_Modulus)
-	DEFINE_METHOD(exponentiate, Fixint_Exponentiate)
-	DEFINE_METHOD(shift_left, Fixint_ShiftLeft)
-	DEFINE_METHOD(shift_right, Fixint_ShiftRight)
-	DEFINE_METHOD(bit_and, Fixint_BitAnd)
-	DEFINE_METHOD(bit_or, Fixint_BitOr)
-	DEFINE_METHOD(bit_xor, Fixint_BitXor)
-	DEFINE_METHOD(numerator, Fixint_Numerator)
-	DEFINE_METHOD(denominator, Fixint_Denominator)
-	if (selector == sym_is_number) return &True_returner;
-	if (selector == sym_is_rational) return &True_returner;
-	if (selector == sym_is_integer) return &True_returner;
+	DISPATCH_METHODS( Fixint_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
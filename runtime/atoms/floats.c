@@ -18,6 +18,7 @@
 //
 // 3. This notice may not be removed or altered from any source distribution.
 
+#include "dispatch.h"
 #include "macros.h"
 #include "floats.h"
 #include "symbols.h"
@@ -105,19 +106,26 @@ static value_t Float_exponentiate( PREFUNC, value_t left, value_t right )
 	return NumberFromDouble( zone, pow( lval, rval ) );
 }
 
+static const struct method_table Float_methods = {
+	(function_t)Float_function,
+	{
+		METHOD_ENTRY(compare_to, Float_compare_to),
+		METHOD_ENTRY(add, Float_add),
+		METHOD_ENTRY(subtract, Float_subtract),
+		METHOD_ENTRY(multiply, Float_multiply),
+		METHOD_ENTRY(divide, Float_divide),
+		METHOD_ENTRY(modulus, Float_modulus),
+		METHOD_ENTRY(exponentiate, Float_exponentiate),
+		METHOD_CLOSURE(is_number, &True_returner),
+		METHOD_CLOSURE(is_rational, &False_returner),
+		METHOD_CLOSURE(is_integer, &False_returner),
+	}
+};
+
 static value_t Float_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD( compare_to, Float_compare_to )
-	DEFINE_METHOD( add, Float_add )
-	DEFINE_METHOD( subtract, Float_subtract )
-	DEFINE_METHOD( multiply, Float_multiply )
-	DEFINE_METHOD( divide, Float_divide )
-	DEFINE_METHOD( modulus, Float_modulus )
-	DEFINE_METHOD( exponentiate, Float_exponentiate )
-	if (selector == sym_is_number) return &True_returner;
-	if (selector == sym_is_rational) return &False_returner;
-	if (selector == sym_is_integer) return &False_returner;
+	DISPATCH_METHODS( Float_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
@@ -25,6 +25,7 @@
 #include "rationals.h"
 #include "floats.h"
 #include <assert.h>
+#include <limits.h>
 #include "macros.h"
 #include "symbols.h"
 
@@ -148,6 +149,31 @@ value_t DivByZeroExp( zone_t zone )
 	return ThrowCStr( zone, "division by zero" );
 }
 
+value_t NumberFromSize( zone_t zone, size_t value )
+{
+	if (value <= INT_MAX) {
+		return NumberFromInt( zone, (int)value );
+	}
+	return BigintFromSize( zone, value );
+}
+
+bool SizeFromNumber( value_t exp, size_t *out )
+{
+	if (IsAFixint( exp )) {
+		int value = IntFromFixint( exp );
+		*out = (value > 0) ? value : 0;
+		return value >= 0;
+	}
+	return IsABigint( exp ) && SizeFromBigint( exp, out );
+}
+
+bool ClampedSizeFromNumber( value_t exp, size_t *out )
+{
+	if (!IsAnInteger( exp )) return false;
+	SizeFromNumber( exp, out );
+	return true;
+}
+
 // init_numbers
 //
 // Allocate some common numbers the runtime uses frequently. This is supposed
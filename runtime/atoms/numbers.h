@@ -41,6 +41,15 @@ bool IsAnInteger( value_t exp );
 value_t NaNExp( zone_t zone, value_t obj );
 value_t DivByZeroExp( zone_t zone );
 
+// Sizes and indexes of things in memory may be too large for a fixint, so we
+// convert them through these, which switch to bigints when they must.
+// SizeFromNumber fails on any integer which is negative or too large to be a
+// size_t; ClampedSizeFromNumber clamps it into range instead, and fails only
+// when the value is not an integer at all.
+value_t NumberFromSize( zone_t zone, size_t value );
+bool SizeFromNumber( value_t exp, size_t *out );
+bool ClampedSizeFromNumber( value_t exp, size_t *out );
+
 #if RUN_TESTS
 void test_numbers( zone_t zone );
 #endif
@@ -28,6 +28,7 @@
 #include "relations.h"
 #include "floats.h"
 #include <assert.h>
+#include "dispatch.h"
 #include "macros.h"
 
 // The rational number is a pair of integers, numerator and denominator, with
@@ -160,21 +161,28 @@ static value_t Rational_denominator( PREFUNC, value_t val )
 	return val->slots[RATIONAL_DENOMINATOR_SLOT];
 }
 
+static const struct method_table Rational_methods = {
+	(function_t)Rational_function,
+	{
+		METHOD_ENTRY(compare_to, Rational_compare_to),
+		METHOD_ENTRY(add, Rational_add),
+		METHOD_ENTRY(subtract, Rational_subtract),
+		METHOD_ENTRY(multiply, Rational_multiply),
+		METHOD_ENTRY(divide, Rational_divide),
+		METHOD_ENTRY(modulus, Rational_modulus),
+		METHOD_ENTRY(exponentiate, Rational_exponentiate),
+		METHOD_ENTRY(numerator, Rational_numerator),
+		METHOD_ENTRY(denominator, Rational_denominator),
+		METHOD_CLOSURE(is_number, &True_returner),
+		METHOD_CLOSURE(is_rational, &True_returner),
+		METHOD_CLOSURE(is_integer, &False_returner),
+	}
+};
+
 static value_t Rational_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD( compare_to, Rational_compare_to )
-	DEFINE_METHOD( add, Rational_add )
-	DEFINE_METHOD( subtract, Rational_subtract )
-	DEFINE_METHOD( multiply, Rational_multiply )
-	DEFINE_METHOD( divide, Rational_divide )
-	DEFINE_METHOD( modulus, Rational_modulus )
-	DEFINE_METHOD( exponentiate, Rational_exponentiate )
-	DEFINE_METHOD( numerator, Rational_numerator )
-	DEFINE_METHOD( denominator, Rational_denominator )
-	if (selector == sym_is_number) return &True_returner;
-	if (selector == sym_is_rational) return &True_returner;
-	if (selector == sym_is_integer) return &False_returner;
+	DISPATCH_METHODS( Rational_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
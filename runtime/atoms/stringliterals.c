@@ -35,62 +35,95 @@
 #include "strings.h"
 #include <assert.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include "symbols.h"
+#include "sequences.h"
+#include "dispatch.h"
 #include "macros.h"
 
-#define STRING_ITERATOR_SLOT_COUNT 2
+// A string literal is a buffer holding a small header, the UTF-8 bytes of the
+// string, and a terminating null byte. The header caches facts which would
+// otherwise cost a full scan of the string to learn: its length in bytes, the
+// number of chars an iterator would visit, and whether every char is ASCII.
+// For an ASCII string, char indexes and byte offsets are the same thing.
+struct string_literal
+{
+	size_t length;
+	size_t codepoints;
+	bool is_ascii;
+	char bytes[];
+};
+#define LITERAL(x) BUFDATA(x, struct string_literal)
+
+#define STRING_ITERATOR_SLOT_COUNT 3
 #define STRING_ITERATOR_TARGET_SLOT 0
 #define STRING_ITERATOR_OFFSET_SLOT 1
+#define STRING_ITERATOR_END_SLOT 2
+
+// A string slice is a view of a range of chars inside some string literal. We
+// only bother making one when the range is large enough to be worth sharing;
+// short slices are cheaper to copy than to describe.
+#define STRING_SLICE_SLOT_COUNT 4
+#define STRING_SLICE_SOURCE_SLOT 0
+#define STRING_SLICE_OFFSET_SLOT 1
+#define STRING_SLICE_LENGTH_SLOT 2
+#define STRING_SLICE_CODEPOINTS_SLOT 3
+#define STRING_SLICE_COPY_THRESHOLD 32
 
 static value_t String_function( PREFUNC, value_t parameter );
+static value_t String_Slice_function( PREFUNC, value_t parameter );
 static value_t String_iterator_function( PREFUNC, value_t parameter );
+static bool StringIsASCII( value_t it );
 static value_t String_iterator_done_function( PREFUNC, value_t parameter );
 static struct closure String_iterator_done =
 		{(function_t)String_iterator_done_function};
 
-static value_t String_iterator_current( PREFUNC, value_t iterator )
+size_t UTF8SequenceLength( byte_t lead )
+{
+	// The leading byte of a UTF-8 character encodes the length of the char's
+	// representation. Continuation bytes and other garbage count as one byte,
+	// so that we always make progress through a malformed string.
+	if (0xF0 == (lead & 0xF0)) {
+		return 4;
+	} else if (0xE0 == (lead & 0xE0)) {
+		return 3;
+	} else if (0xC0 == (lead & 0xC0)) {
+		return 2;
+	}
+	return 1;
+}
+
+static int DecodeChar( const byte_t *bytes, size_t offset, size_t end )
 {
-	ARGCHECK_1( iterator );
-	value_t string = iterator->slots[STRING_ITERATOR_TARGET_SLOT];
-	unsigned offset =
-			IntFromFixint( iterator->slots[STRING_ITERATOR_OFFSET_SLOT] );
 	// Decode the UTF-8 character located at this position. If we find any
 	// problems, we will return U+FFFD, the standard error character.
 
 	// Make sure we have not yet run off the end of the buffer.
-	if (offset >= BUFFER(string)->size) {
-		return NumberFromInt( zone, 0xFFFD );
+	if (offset >= end) {
+		return 0xFFFD;
 	}
 
 	// Peek at the first byte of the char to figure out how long the whole
 	// production is going to be.
-	unsigned char *src = &(BUFFER(string)->bytes[offset]);
-	unsigned char ch = *src;
-	unsigned int charlen = 1;
-	if (0xF0 == (ch & 0xF0)) {
-		charlen = 4;
-	} else if (0xE0 == (ch & 0xE0)) {
-		charlen = 3;
-	} else if (0xC0 == (ch & 0xC0)) {
-		charlen = 2;
-	}
+	const byte_t *src = &bytes[offset];
+	unsigned int charlen = UTF8SequenceLength( *src );
 
 	// Some bytes begin character sequences and others continue them. We must
 	// never start with a continuing character.
-	if (0x80 == (ch & 0xC0)) {
-		return NumberFromInt( zone, 0xFFFD );
+	if (0x80 == (*src & 0xC0)) {
+		return 0xFFFD;
 	}
 
 	// Make sure there is enough space left in the buffer to hold this char.
-	if (offset + charlen > BUFFER(string)->size) {
-		return NumberFromInt( zone, 0xFFFD );
+	if (offset + charlen > end) {
+		return 0xFFFD;
 	}
 
 	// We've cleared away all the possible errors and we know how many bytes
 	// will contribute to the char. Assemble it and return it.
-	unsigned int out = 0;
+	int out = 0;
 	switch (charlen) {
 		case 1: {
 			out = *src;
@@ -111,57 +144,136 @@ static value_t String_iterator_current( PREFUNC, value_t iterator )
 				(src[3] & 0x3F);
 		} break;
 	}
-	return NumberFromInt( zone, out );
+	return out;
 }
 
-static value_t String_iterator_next( PREFUNC, value_t iterator )
+static bool IsASCII( const byte_t *bytes, size_t length )
 {
-	ARGCHECK_1( iterator );
-	value_t string = iterator->slots[STRING_ITERATOR_TARGET_SLOT];
-	unsigned offset =
-			IntFromFixint( iterator->slots[STRING_ITERATOR_OFFSET_SLOT] );
+	// Check a whole word at a time; we only need to know whether any byte in
+	// the string has its high bit set.
+	uint64_t bits = 0;
+	size_t i = 0;
+	for (; i + sizeof(bits) <= length; i += sizeof(bits)) {
+		uint64_t word;
+		memcpy( &word, &bytes[i], sizeof(word) );
+		bits |= word;
+	}
+	for (; i < length; i++) {
+		bits |= bytes[i];
+	}
+	return 0 == (bits & 0x8080808080808080ULL);
+}
 
-	// Advance past the current character so we can prepare to read in the next
-	// one. The leading byte of a UTF-8 character encodes the length of the
-	// char's represention.
-	char ch = BUFFER(string)->bytes[offset];
-	if (0xF0 == (ch & 0xF0)) {
-		offset += 4;
-	} else if (0xE0 == (ch & 0xE0)) {
-		offset += 3;
-	} else if (0xC0 == (ch & 0xC0)) {
-		offset += 2;
-	} else {
-		offset += 1;
+size_t CountCodepoints( const byte_t *bytes, size_t length )
+{
+	size_t codepoints = 0;
+	for (size_t i = 0; i < length; i += UTF8SequenceLength( bytes[i] )) {
+		codepoints++;
 	}
+	return codepoints;
+}
 
-	// If we have run off the end of the string, bail out and tell the caller
-	// that our string is finished. There are two ways this might happen: we
-	// might have run out of bytes in the buffer, or we might have encountered
-	// a NULL character. The latter only exists because we leave stray null
-	// bytes in our buffers - this lets CStrFromStringLiteral return a pointer
-	// to the string buffer without having to do a copy.
-	if (offset >= BUFFER(string)->size) {
-		return &String_iterator_done;
+static void MeasureLiteral( struct string_literal *lit, size_t bytes )
+{
+	// Iteration stops at the first null byte, so as far as anyone else can
+	// tell, that is where the string ends. Count the chars by stepping over
+	// them exactly as an iterator would, so that the cached count agrees with
+	// the iterator even when the string is malformed.
+	const byte_t *src = (const byte_t*)lit->bytes;
+	size_t length = strnlen( lit->bytes, bytes );
+	lit->length = length;
+	lit->is_ascii = IsASCII( src, length );
+	if (lit->is_ascii) {
+		lit->codepoints = length;
+	} else {
+		lit->codepoints = CountCodepoints( src, length );
 	}
-	if ('\0' == BUFFER(string)->bytes[offset]) {
+}
+
+static value_t MakeStringIterator(
+		zone_t zone, value_t string, size_t offset, size_t end )
+{
+	// Iterators always point into a literal. A slice's iterator points at its
+	// source literal, but stops at the end of the slice.
+	assert( IsAStringLiteral( string ) );
+	if (offset >= end) {
 		return &String_iterator_done;
 	}
-
-	// Create an iterator pointing at the next character in the string.
 	struct closure *out =
 			ALLOC( String_iterator_function, STRING_ITERATOR_SLOT_COUNT );
 	out->slots[STRING_ITERATOR_TARGET_SLOT] = string;
 	out->slots[STRING_ITERATOR_OFFSET_SLOT] = NumberFromInt( zone, offset );
+	out->slots[STRING_ITERATOR_END_SLOT] = NumberFromInt( zone, end );
 	return out;
 }
 
+static value_t String_iterator_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t string = iterator->slots[STRING_ITERATOR_TARGET_SLOT];
+	unsigned offset =
+			IntFromFixint( iterator->slots[STRING_ITERATOR_OFFSET_SLOT] );
+	unsigned end = IntFromFixint( iterator->slots[STRING_ITERATOR_END_SLOT] );
+	const byte_t *bytes = (const byte_t*)LITERAL(string)->bytes;
+	return NumberFromInt( zone, DecodeChar( bytes, offset, end ) );
+}
+
+static value_t String_iterator_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t string = iterator->slots[STRING_ITERATOR_TARGET_SLOT];
+	unsigned offset =
+			IntFromFixint( iterator->slots[STRING_ITERATOR_OFFSET_SLOT] );
+	unsigned end = IntFromFixint( iterator->slots[STRING_ITERATOR_END_SLOT] );
+
+	// Advance past the current character so we can prepare to read in the next
+	// one. If we have run off the end of the string, the new iterator will
+	// tell the caller that our string is finished. We don't have to look for
+	// stray null bytes here, since the literal's length already stops short
+	// of the first one.
+	byte_t ch = LITERAL(string)->bytes[offset];
+	offset += UTF8SequenceLength( ch );
+	return MakeStringIterator( zone, string, offset, end );
+}
+
+static value_t String_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t string = iterator->slots[STRING_ITERATOR_TARGET_SLOT];
+	unsigned offset =
+			IntFromFixint( iterator->slots[STRING_ITERATOR_OFFSET_SLOT] );
+	unsigned end = IntFromFixint( iterator->slots[STRING_ITERATOR_END_SLOT] );
+	const byte_t *bytes = (const byte_t*)LITERAL(string)->bytes;
+	value_t items[BATCH_LIMIT];
+	size_t taken = 0;
+	while (taken < limit && offset < end) {
+		int ch = DecodeChar( bytes, offset, end );
+		items[taken++] = NumberFromInt( zone, ch );
+		offset += UTF8SequenceLength( bytes[offset] );
+	}
+	value_t rest = MakeStringIterator( zone, string, offset, end );
+	return MakeBatch( zone, items, taken, rest );
+}
+
+static const struct method_table String_iterator_methods = {
+	(function_t)String_iterator_function,
+	{
+		METHOD_ENTRY(current, String_iterator_current),
+		METHOD_ENTRY(next, String_iterator_next),
+		METHOD_ENTRY(next_n, String_iterator_next_n),
+		METHOD_CLOSURE(is_valid, &True_returner),
+	}
+};
+
 static value_t String_iterator_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(current, String_iterator_current)
-	DEFINE_METHOD(next, String_iterator_next)
-	if (selector == sym_is_valid) return &True_returner;
+	DISPATCH_METHODS( String_iterator_methods );
 	return ThrowCStrNotFound( zone, "not found (string iterator)", selector );
 }
 
@@ -177,28 +289,26 @@ static value_t String_iterator_done_next( PREFUNC, value_t iter )
 	return ThrowCStr( zone, "the iterator is not valid" );
 }
 
+static const struct method_table String_iterator_done_methods = {
+	(function_t)String_iterator_done_function,
+	{
+		METHOD_ENTRY(current, String_iterator_done_current),
+		METHOD_ENTRY(next, String_iterator_done_next),
+		METHOD_CLOSURE(is_valid, &False_returner),
+	}
+};
+
 static value_t String_iterator_done_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(current, String_iterator_done_current)
-	DEFINE_METHOD(next, String_iterator_done_next)
-	if (selector == sym_is_valid) return &False_returner;
+	DISPATCH_METHODS( String_iterator_done_methods );
 	return ThrowCStrNotFound( zone, "not found (string iter done)", selector );
 }
 
 static value_t String_iterate( PREFUNC, value_t string )
 {
 	ARGCHECK_1( string );
-	if (BUFFER(string)->bytes[0]) {
-		struct closure *out =
-				ALLOC( String_iterator_function, STRING_ITERATOR_SLOT_COUNT );
-		out->slots[STRING_ITERATOR_TARGET_SLOT] = string;
-		out->slots[STRING_ITERATOR_OFFSET_SLOT] = num_zero;
-		return out;
-	}
-	else {
-		return &String_iterator_done;
-	}
+	return MakeStringIterator( zone, string, 0, LITERAL(string)->length );
 }
 
 static value_t String_concatenate( PREFUNC, value_t left, value_t right )
@@ -213,15 +323,80 @@ static value_t String_compare_to( PREFUNC, value_t left, value_t right )
 	return CompareStrings( zone, left, right );
 }
 
+static value_t String_length( PREFUNC, value_t string )
+{
+	ARGCHECK_1( string );
+	return StringLength( zone, string );
+}
+
+static value_t String_slice(
+		PREFUNC, value_t string, value_t skip, value_t count )
+{
+	ARGCHECK_3( string, skip, count );
+	return SliceString( zone, string, skip, count );
+}
+
+static value_t String_lookup( PREFUNC, value_t string, value_t index )
+{
+	ARGCHECK_2( string, index );
+	return LookupString( zone, string, index );
+}
+
+static const struct method_table String_methods = {
+	(function_t)String_function,
+	{
+		METHOD_ENTRY(iterate, String_iterate),
+		METHOD_ENTRY(concatenate, String_concatenate),
+		METHOD_ENTRY(compare_to, String_compare_to),
+		METHOD_ENTRY(length, String_length),
+		METHOD_ENTRY(slice, String_slice),
+		METHOD_ENTRY(lookup, String_lookup),
+	}
+};
+
 static value_t String_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(iterate, String_iterate)
-	DEFINE_METHOD(concatenate, String_concatenate)
-	DEFINE_METHOD(compare_to, String_compare_to)
+	DISPATCH_METHODS( String_methods );
+	// Offering size marks a sequence as random-access. Only an ASCII string
+	// can look its chars up by index without scanning from the start.
+	if (StringIsASCII( self )) {
+		DEFINE_METHOD(size, String_length)
+	}
 	return ThrowCStrNotFound( zone, "not found (string)", selector );
 }
 
+static value_t String_Slice_iterate( PREFUNC, value_t slice )
+{
+	ARGCHECK_1( slice );
+	value_t source = slice->slots[STRING_SLICE_SOURCE_SLOT];
+	size_t offset = IntFromFixint( slice->slots[STRING_SLICE_OFFSET_SLOT] );
+	size_t length = IntFromFixint( slice->slots[STRING_SLICE_LENGTH_SLOT] );
+	return MakeStringIterator( zone, source, offset, offset + length );
+}
+
+static const struct method_table String_Slice_methods = {
+	(function_t)String_Slice_function,
+	{
+		METHOD_ENTRY(iterate, String_Slice_iterate),
+		METHOD_ENTRY(concatenate, String_concatenate),
+		METHOD_ENTRY(compare_to, String_compare_to),
+		METHOD_ENTRY(length, String_length),
+		METHOD_ENTRY(slice, String_slice),
+		METHOD_ENTRY(lookup, String_lookup),
+	}
+};
+
+static value_t String_Slice_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( String_Slice_methods );
+	if (StringIsASCII( self )) {
+		DEFINE_METHOD(size, String_length)
+	}
+	return ThrowCStrNotFound( zone, "not found (string slice)", selector );
+}
+
 value_t StringLiteral( zone_t zone, const char *data, size_t length )
 {
 	// The compiler bakes string literals in as zero-terminated C strings.
@@ -249,28 +424,37 @@ value_t StringFromUTF8Bytes( zone_t zone, const char *data, size_t bytes )
 	// we cannot use clone_buffer(), because it wants to copy an entire buffer,
 	// whereas we need to insert an additional terminator byte so that the
 	// contents of a string literal atom can function as a C string.
-	struct buffer *out =
-			alloc_buffer( zone, (function_t)String_function, bytes + 1 );
-	memcpy( out->bytes, data, bytes );
-	out->bytes[bytes] = '\0';
+	struct buffer *out = alloc_buffer( zone, (function_t)String_function,
+			sizeof(struct string_literal) + bytes + 1 );
+	struct string_literal *lit = (struct string_literal*)out->bytes;
+	memcpy( lit->bytes, data, bytes );
+	lit->bytes[bytes] = '\0';
+	MeasureLiteral( lit, bytes );
 	return (value_t)out;
 }
 
 value_t ConcatStringLiterals( zone_t zone, value_t left, value_t right )
 {
-	assert( IsAStringLiteral( left ) );
-	assert( IsAStringLiteral( right ) );
-	// We know that each of these has a buffer which includes a terminator.
-	// We will create a new buffer large enough to contain both buffers but
-	// only one terminator.
-	size_t left_size = BUFFER(left)->size - 1;
-	size_t right_size = BUFFER(right)->size - 1;
-	size_t new_size = left_size + right_size + 1;
-	struct buffer *out =
-			alloc_buffer( zone, (function_t)String_function, new_size );
-	memcpy( out->bytes, BUFFER(left)->bytes, left_size );
-	memcpy( &out->bytes[left_size], BUFFER(right)->bytes, right_size );
-	out->bytes[new_size-1] = '\0';
+	// Each of these strings lives in a contiguous run of bytes, either its own
+	// literal buffer or a slice of someone else's. We will create a new buffer
+	// large enough to contain both runs plus a terminator.
+	const byte_t *left_bytes = NULL;
+	const byte_t *right_bytes = NULL;
+	size_t left_size = 0;
+	size_t right_size = 0;
+	bool left_ok = StringBytes( left, &left_bytes, &left_size );
+	bool right_ok = StringBytes( right, &right_bytes, &right_size );
+	assert( left_ok && right_ok );
+	(void)left_ok;
+	(void)right_ok;
+	size_t new_size = left_size + right_size;
+	struct buffer *out = alloc_buffer( zone, (function_t)String_function,
+			sizeof(struct string_literal) + new_size + 1 );
+	struct string_literal *lit = (struct string_literal*)out->bytes;
+	memcpy( lit->bytes, left_bytes, left_size );
+	memcpy( &lit->bytes[left_size], right_bytes, right_size );
+	lit->bytes[new_size] = '\0';
+	MeasureLiteral( lit, new_size );
 	return (value_t)out;
 }
 
@@ -317,10 +501,150 @@ const struct closure char_from_int = {(function_t)String_From_Codepoint};
 const char *CStrFromStringLiteral( value_t it )
 {
 	assert( IsAStringLiteral( it ) );
-	return (const char*)BUFFER(it)->bytes;
+	return LITERAL(it)->bytes;
 }
 
 bool IsAStringLiteral( value_t it )
 {
 	return it && it->function == (function_t)String_function;
 }
+
+bool IsAStringSlice( value_t it )
+{
+	return it && it->function == (function_t)String_Slice_function;
+}
+
+bool StringBytes( value_t it, const byte_t **bytes, size_t *length )
+{
+	// If this string lives in a contiguous run of bytes, point at them.
+	if (IsAStringLiteral( it )) {
+		*bytes = (const byte_t*)LITERAL(it)->bytes;
+		*length = LITERAL(it)->length;
+		return true;
+	}
+	if (IsAStringSlice( it )) {
+		value_t source = it->slots[STRING_SLICE_SOURCE_SLOT];
+		size_t offset = IntFromFixint( it->slots[STRING_SLICE_OFFSET_SLOT] );
+		*bytes = (const byte_t*)&LITERAL(source)->bytes[offset];
+		*length = IntFromFixint( it->slots[STRING_SLICE_LENGTH_SLOT] );
+		return true;
+	}
+	return false;
+}
+
+bool StringCodepoints( value_t it, size_t *codepoints )
+{
+	if (IsAStringLiteral( it )) {
+		*codepoints = LITERAL(it)->codepoints;
+		return true;
+	}
+	if (IsAStringSlice( it )) {
+		*codepoints = IntFromFixint( it->slots[STRING_SLICE_CODEPOINTS_SLOT] );
+		return true;
+	}
+	return false;
+}
+
+static bool StringIsASCII( value_t it )
+{
+	// A slice of an ASCII literal is also ASCII. A slice of some other literal
+	// might happen to be ASCII too, but we don't bother finding out.
+	if (IsAStringSlice( it )) {
+		it = it->slots[STRING_SLICE_SOURCE_SLOT];
+	}
+	return LITERAL(it)->is_ascii;
+}
+
+static size_t CodepointOffset(
+		bool is_ascii, const byte_t *bytes, size_t length, size_t index )
+{
+	// Find the byte offset of the char at this index. That's free for ASCII
+	// strings; anything else, we have to walk.
+	size_t offset = index;
+	if (!is_ascii) {
+		offset = 0;
+		while (index > 0 && offset < length) {
+			offset += UTF8SequenceLength( bytes[offset] );
+			index--;
+		}
+	}
+	return (offset < length) ? offset : length;
+}
+
+static value_t MakeSlice(
+		zone_t zone,
+		value_t it,
+		const byte_t *bytes,
+		size_t length,
+		size_t begin,
+		size_t end,
+		size_t codepoints )
+{
+	if (0 == begin && end == length) {
+		return it;
+	}
+	if (end - begin < STRING_SLICE_COPY_THRESHOLD) {
+		const char *data = (const char*)&bytes[begin];
+		return StringFromUTF8Bytes( zone, data, end - begin );
+	}
+	// Make a view of the source literal rather than copying its bytes. We
+	// never make a slice of a slice; we just narrow the range.
+	value_t source = it;
+	if (IsAStringSlice( it )) {
+		source = it->slots[STRING_SLICE_SOURCE_SLOT];
+	}
+	size_t base = bytes - (const byte_t*)LITERAL(source)->bytes;
+	struct closure *out =
+			ALLOC( String_Slice_function, STRING_SLICE_SLOT_COUNT );
+	out->slots[STRING_SLICE_SOURCE_SLOT] = source;
+	out->slots[STRING_SLICE_OFFSET_SLOT] = NumberFromInt( zone, base + begin );
+	out->slots[STRING_SLICE_LENGTH_SLOT] = NumberFromInt( zone, end - begin );
+	out->slots[STRING_SLICE_CODEPOINTS_SLOT] =
+			NumberFromInt( zone, codepoints );
+	return out;
+}
+
+value_t SliceContiguousString(
+		zone_t zone, value_t it, size_t skip, size_t count )
+{
+	// The caller has already clamped the range to the bounds of the string.
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	bool ok = StringBytes( it, &bytes, &length );
+	assert( ok );
+	(void)ok;
+	bool is_ascii = StringIsASCII( it );
+	size_t begin = CodepointOffset( is_ascii, bytes, length, skip );
+	size_t end = begin +
+			CodepointOffset( is_ascii, &bytes[begin], length - begin, count );
+	return MakeSlice( zone, it, bytes, length, begin, end, count );
+}
+
+value_t SliceStringBytes( zone_t zone, value_t it, size_t begin, size_t end )
+{
+	// The caller found these offsets by searching the string's own bytes, so
+	// they already lie on char boundaries.
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	bool ok = StringBytes( it, &bytes, &length );
+	assert( ok && begin <= end && end <= length );
+	(void)ok;
+	size_t codepoints = end - begin;
+	if (!StringIsASCII( it )) {
+		codepoints = CountCodepoints( &bytes[begin], end - begin );
+	}
+	return MakeSlice( zone, it, bytes, length, begin, end, codepoints );
+}
+
+value_t LookupContiguousString( zone_t zone, value_t it, size_t index )
+{
+	// The caller has already made sure that the index is in bounds.
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	bool ok = StringBytes( it, &bytes, &length );
+	assert( ok );
+	(void)ok;
+	bool is_ascii = StringIsASCII( it );
+	size_t offset = CodepointOffset( is_ascii, bytes, length, index );
+	return NumberFromInt( zone, DecodeChar( bytes, offset, length ) );
+}
@@ -44,6 +44,26 @@ value_t StringFromUTF8Bytes( zone_t zone, const char *data, size_t bytes );
 // the above StringFrom functions.
 const char *CStrFromStringLiteral( value_t it );
 bool IsAStringLiteral( value_t it );
+bool IsAStringSlice( value_t it );
+
+// Literals and slices of literals keep their chars in one contiguous run of
+// UTF-8 bytes and know how many chars they contain, so the generic string
+// functions can work on them directly instead of iterating.
+bool StringBytes( value_t it, const byte_t **bytes, size_t *length );
+bool StringCodepoints( value_t it, size_t *codepoints );
+size_t UTF8SequenceLength( byte_t lead );
+size_t CountCodepoints( const byte_t *bytes, size_t length );
+
+// Slice and lookup by char index on a literal or a slice. The caller must
+// already have checked the range against StringCodepoints.
+value_t SliceContiguousString(
+		zone_t zone, value_t it, size_t skip, size_t count );
+value_t LookupContiguousString( zone_t zone, value_t it, size_t index );
+
+// Slice a literal or a slice by byte offsets relative to its StringBytes. The
+// offsets must fall on char boundaries, as they will if they came from a
+// search of the same bytes.
+value_t SliceStringBytes( zone_t zone, value_t it, size_t begin, size_t end );
 
 // Make a new string literal object from two existing ones, by concatenating
 // their buffers. This is almost certainly not the function you want; look in
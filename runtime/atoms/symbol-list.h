@@ -58,11 +58,13 @@ SYMBOL(is_rational);
 SYMBOL(is_running);
 SYMBOL(is_valid);
 SYMBOL(iterate);
+SYMBOL(length);
 SYMBOL(load_external);
 SYMBOL(lookup);
 SYMBOL(modulus);
 SYMBOL(multiply);
 SYMBOL(next);
+SYMBOL(next_n);
 SYMBOL(numerator);
 SYMBOL(partition);
 SYMBOL(pointer);
@@ -76,6 +78,7 @@ SYMBOL(send);
 SYMBOL(shift_left);
 SYMBOL(shift_right);
 SYMBOL(size);
+SYMBOL(slice);
 SYMBOL(start);
 SYMBOL(subtract);
 SYMBOL(tail);
@@ -25,39 +25,67 @@
 #include "exceptions.h"
 #include "relations.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include "threads.h"
 
-// The symbol struct is the data payload in a buffer object. This means we have
-// object pointers in a buffer, which is normally not allowed due to garbage
-// collection constraints. We get away with it because these refs only ever
-// point at other symbols, and symbols are immortal.
+// The symbol struct is the data payload in a buffer object. Symbols are
+// interned, so two symbols are equal if and only if they are the same object.
+// Each one also carries a dense integer ID, assigned in order of creation, so
+// that runtime code can index tables by symbol. The symbols named in
+// symbol-list.h are created first, in list order, so their IDs are the
+// compile-time constants given by SYMBOL_ID.
 struct symbol {
 	const char *key;
-	unsigned int level;
-	value_t left;
-	value_t right;
+	uint32_t hash;
+	uint32_t id;
 };
 
-// Insert lock protects writes to the symbol tree.
+// All symbols live in an open-addressing hash table. Lookups never take a
+// lock: they load the current table, probe it, and compare keys only when the
+// hashes match. Inserts take the insert lock, then either fill an empty slot
+// with a release store, or build a larger copy of the table and publish that.
+// Old tables are never freed, since a reader might still be probing one; the
+// leftovers add up to less than the size of the current table. A reader who
+// misses a symbol because it raced with an insert will retry under the lock.
+struct symbol_table {
+	size_t capacity;
+	size_t count;
+	value_t slots[];
+};
+#define SYMBOL_TABLE_INITIAL_CAPACITY 1024
+
+// The symbols are also listed by ID, in pages which never move once they have
+// been allocated, so that readers can find a symbol by ID without locking.
+#define SYMBOL_PAGE_SIZE 1024
+#define SYMBOL_PAGE_COUNT 4096
+
 static thread_mutex_t sInsertLock;
-static value_t sSymbolTree;
+static struct symbol_table *sSymbolTable;
+static value_t *sSymbolPages[SYMBOL_PAGE_COUNT];
+static uint32_t sSymbolCount;
 
 // Define the storage for all of the symbol variables.
 #define SYMBOL(x) value_t sym_##x
 #include "symbol-list.h"
 #undef SYMBOL
 
+#define SYMBOL_DATA(x) BUFDATA(x, struct symbol)
+
 static value_t Symbol_compare_to( PREFUNC, value_t left, value_t right )
 {
 	ARGCHECK_2( left, right );
 	if (!IsASymbol( left ) || !IsASymbol( right )) {
 		return ThrowCStr( zone, "can't compare a symbol with a non-symbol");
 	}
-	const char *leftkey = BUFDATA(left, struct symbol)->key;
-	const char *rightkey = BUFDATA(right, struct symbol)->key;
+	// Symbols are interned, so identical symbols are the same object. Any
+	// others are ordered by name, which is how maps keyed by symbols expect
+	// to see them.
+	if (left == right) return EqualTo();
+	const char *leftkey = SYMBOL_DATA(left)->key;
+	const char *rightkey = SYMBOL_DATA(right)->key;
 	int relation = strcmp( leftkey, rightkey );
 	if (relation < 0) return LessThan();
 	else if (relation > 0) return GreaterThan();
@@ -71,76 +99,99 @@ static value_t Symbol_function( PREFUNC, value_t selector )
 	return ThrowCStr( zone, "symbol does not have that member");
 }
 
-static bool Insert( value_t *target, const char *data, value_t *dest )
+static uint32_t HashKey( const char *data )
 {
-	// Attempt to insert a new symbol representing the char data into the
-	// master symbol tree. We maintain a balanced tree using the Andersson
-	// algorithm; that is, this is an AA-tree like the standard map container.
-	assert( target && data && dest );
-	value_t node = *target;
-
-	if (NULL == node) {
-		// End of the line: we have found the spot the symbol should live, and
-		// there is nothing there. We will fill it with a new symbol instance.
-		// Symbols must live in the root zone, because they are global and
-		// immortal, shared among all threads; they must never be collected.
-		zone_t zone = root_zone();
-		struct buffer *out = BUFALLOC( Symbol_function, sizeof(struct symbol) );
-		BUFDATA(out, struct symbol)->key = data;
-		BUFDATA(out, struct symbol)->level = 1;
-		*target = (value_t)out;
-		*dest = (value_t)out;
-		return true;
+	// FNV-1a: cheap, and good enough for identifiers.
+	uint32_t hash = 2166136261u;
+	for (const byte_t *c = (const byte_t*)data; *c; c++) {
+		hash = (hash ^ *c) * 16777619u;
 	}
+	return hash;
+}
 
-	const char *nodekey = BUFDATA(node, struct symbol)->key;
-	int relation = strcmp( nodekey, data );
-	bool did_modify = false;
-	if (relation > 0) {
-		did_modify = Insert( &BUFDATA(node, struct symbol)->left, data, dest );
-	} else if (relation < 0) {
-		did_modify = Insert( &BUFDATA(node, struct symbol)->right, data, dest );
-	} else {
-		// The quick search does not assert the mutex, so it is vulnerable to
-		// false negatives. Some other thread was modifying the tree while we
-		// waited for the mutex: either it just inserted the same symbol we are
-		// now looking for, or it was rebalancing the tree in a way that left
-		// the target symbol inaccessible. Either way, we have found the symbol
-		// now, so we might as well return it.
-		*dest = node;
+static value_t Probe(
+		const struct symbol_table *table,
+		const char *data,
+		uint32_t hash,
+		size_t *empty )
+{
+	// Look for the symbol, starting at its home slot and moving along until we
+	// either find it or reach an empty slot.
+	size_t mask = table->capacity - 1;
+	for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+		value_t slot = __atomic_load_n( &table->slots[i], __ATOMIC_ACQUIRE );
+		if (!slot) {
+			if (empty) *empty = i;
+			return NULL;
+		}
+		const struct symbol *sym = SYMBOL_DATA(slot);
+		if (sym->hash == hash && 0 == strcmp( sym->key, data )) {
+			return slot;
+		}
 	}
+}
 
-	// If one of our children inserted a new node, we need to rebalance the
-	// tree. First we will perform the "skew": if our left node's level is
-	// equal to our level, rotate right.
-	unsigned int level = BUFDATA(node, struct symbol)->level;
-	value_t left = BUFDATA(node, struct symbol)->left;
-	value_t right = BUFDATA(node, struct symbol)->right;
-	if (did_modify && left && level == BUFDATA(left, struct symbol)->level) {
-		BUFDATA(node, struct symbol)->left = 
-			BUFDATA(left, struct symbol)->right;
-		BUFDATA(left, struct symbol)->right = node;
-		node = left;
-	}
+static struct symbol_table *AllocTable( size_t capacity )
+{
+	size_t bytes = sizeof(struct symbol_table) + capacity * sizeof(value_t);
+	struct symbol_table *table = calloc( 1, bytes );
+	assert( table );
+	table->capacity = capacity;
+	return table;
+}
 
-	// Next perform the "split": if our right node's right node is equal to
-	// our level, rotate left. This may raise us up a level.
-	if (did_modify && right) {
-		value_t rightright = BUFDATA(right, struct symbol)->right;
-		if (rightright && BUFDATA(rightright, struct symbol)->level == level) {
-			BUFDATA(node, struct symbol)->right =
-				BUFDATA(right, struct symbol)->left;
-			BUFDATA(right, struct symbol)->left = node;
-			node = right;
-			BUFDATA(node, struct symbol)->level++;
+static void Grow(void)
+{
+	// Rehash every symbol into a table twice the size, then publish it. We
+	// hold the insert lock, so nobody else is changing the old table.
+	struct symbol_table *old = sSymbolTable;
+	struct symbol_table *table = AllocTable( old->capacity * 2 );
+	size_t mask = table->capacity - 1;
+	for (size_t i = 0; i < old->capacity; i++) {
+		value_t slot = old->slots[i];
+		if (!slot) continue;
+		size_t j = SYMBOL_DATA(slot)->hash & mask;
+		while (table->slots[j]) {
+			j = (j + 1) & mask;
 		}
+		table->slots[j] = slot;
 	}
+	table->count = old->count;
+	__atomic_store_n( &sSymbolTable, table, __ATOMIC_RELEASE );
+}
 
-	if (did_modify) {
-		*target = node;
+static value_t Insert( const char *data, uint32_t hash )
+{
+	// Symbols must live in the root zone, because they are global and
+	// immortal, shared among all threads; they must never be collected.
+	struct symbol_table *table = sSymbolTable;
+	size_t empty = 0;
+	value_t found = Probe( table, data, hash, &empty );
+	if (found) {
+		// Some other thread inserted this symbol while we waited for the lock.
+		return found;
 	}
-
-	return did_modify;
+	uint32_t id = sSymbolCount;
+	size_t page = id / SYMBOL_PAGE_SIZE;
+	assert( page < SYMBOL_PAGE_COUNT );
+	if (!sSymbolPages[page]) {
+		value_t *entries = calloc( SYMBOL_PAGE_SIZE, sizeof(value_t) );
+		assert( entries );
+		__atomic_store_n( &sSymbolPages[page], entries, __ATOMIC_RELEASE );
+	}
+	zone_t zone = root_zone();
+	struct buffer *out = BUFALLOC( Symbol_function, sizeof(struct symbol) );
+	SYMBOL_DATA(out)->key = data;
+	SYMBOL_DATA(out)->hash = hash;
+	SYMBOL_DATA(out)->id = id;
+	sSymbolPages[page][id % SYMBOL_PAGE_SIZE] = (value_t)out;
+	__atomic_store_n( &sSymbolCount, id + 1, __ATOMIC_RELEASE );
+	__atomic_store_n( &table->slots[empty], (value_t)out, __ATOMIC_RELEASE );
+	// Keep the table no more than half full, so probe sequences stay short.
+	if (++table->count * 2 > table->capacity) {
+		Grow();
+	}
+	return (value_t)out;
 }
 
 value_t SymbolLiteral( zone_t zone, const char *data )
@@ -152,34 +203,36 @@ value_t SymbolLiteral( zone_t zone, const char *data )
 	// We expect that the data is immortal - this function is designed for
 	// symbol literals, so the input data should come from the executable's
 	// static data section.
-
-	// Perform a quick, optimistic, nonrecursive search. Most of the time we
-	// ought to find the symbol we are looking for, so we will not waste a lot
-	// of time dealing with mutexes.
-	value_t target = sSymbolTree;
-	while (target) {
-		assert( IsASymbol( target ) );
-		const char *targetkey = BUFDATA(target, struct symbol)->key;
-		int relation = strcmp( targetkey, data );
-		if (0 == relation) {
-			return target;
-		} else if (relation > 0) {
-			target = BUFDATA(target, struct symbol)->left;
-		} else if (relation < 0) {
-			target = BUFDATA(target, struct symbol)->right;
-		}
+	uint32_t hash = HashKey( data );
+	const struct symbol_table *table =
+			__atomic_load_n( &sSymbolTable, __ATOMIC_ACQUIRE );
+	value_t out = Probe( table, data, hash, NULL );
+	if (!out) {
+		// We didn't find a match, so we'll try to insert a new symbol
+		// instance. For this operation, we need exclusive write access.
+		thread_mutex_lock( &sInsertLock );
+		out = Insert( data, hash );
+		thread_mutex_unlock( &sInsertLock );
 	}
-
-	// We didn't find a match, so we'll try to insert a new symbol instance.
-	// For this operation, we definitely need exclusive write access to the
-	// symbol tree.
-	thread_mutex_lock( &sInsertLock );
-	value_t out = NULL;
-	Insert( &sSymbolTree, data, &out );
-	thread_mutex_unlock( &sInsertLock );
 	return out;
 }
 
+uint32_t SymbolID( value_t it )
+{
+	assert( IsASymbol( it ) );
+	return SYMBOL_DATA(it)->id;
+}
+
+value_t SymbolFromID( uint32_t id )
+{
+	// Returns NULL if no symbol has been given this ID yet.
+	if (id >= __atomic_load_n( &sSymbolCount, __ATOMIC_ACQUIRE )) {
+		return NULL;
+	}
+	value_t *page = sSymbolPages[id / SYMBOL_PAGE_SIZE];
+	return page[id % SYMBOL_PAGE_SIZE];
+}
+
 bool IsASymbol( value_t obj )
 {
 	return obj && obj->function == (function_t)Symbol_function;
@@ -188,14 +241,17 @@ bool IsASymbol( value_t obj )
 const char *CStrFromSymbol( value_t it )
 {
 	assert( IsASymbol( it ) );
-	return BUFDATA(it, struct symbol)->key;
+	return SYMBOL_DATA(it)->key;
 }
 
 void init_symbols( zone_t zone )
 {
 	thread_mutex_create( &sInsertLock );
-	// Initialize all of the symbol variables.
-	#define SYMBOL(x) sym_##x = SymbolLiteral( zone, #x )
+	sSymbolTable = AllocTable( SYMBOL_TABLE_INITIAL_CAPACITY );
+	// Initialize all of the symbol variables. These are the first symbols we
+	// create, so each one's ID will match its SYMBOL_ID constant.
+	#define SYMBOL(x) sym_##x = SymbolLiteral( zone, #x ); \
+		assert( SymbolID( sym_##x ) == SYMBOL_ID(x) )
 	#include "symbol-list.h"
 	#undef SYMBOL
 }
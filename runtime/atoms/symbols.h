@@ -23,6 +23,8 @@
 #define symbols_h
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "../closures.h"
 
 // These vars must only ever be assigned from init_symbols(), which must be
@@ -33,9 +35,24 @@
 #include "symbol-list.h"
 #undef SYMBOL
 
+// Every symbol has a dense integer ID. The symbols in symbol-list.h are
+// created first, in list order, so their IDs are compile-time constants;
+// runtime code can use SYMBOL_ID(x) to build tables indexed by selector. The
+// list's entries end in semicolons, so we number them by laying them out as
+// one-byte struct members and taking their offsets.
+struct symbol_id_layout {
+#define SYMBOL(x) char sym_##x
+#include "symbol-list.h"
+#undef SYMBOL
+};
+#define SYMBOL_ID(x) ((uint32_t)offsetof(struct symbol_id_layout, sym_##x))
+#define SYMBOL_ID_COUNT ((uint32_t)sizeof(struct symbol_id_layout))
+
 void init_symbols( zone_t zone );
 value_t SymbolLiteral( zone_t zone, const char *data );
 bool IsASymbol( value_t obj );
 const char *CStrFromSymbol( value_t it );
+uint32_t SymbolID( value_t it );
+value_t SymbolFromID( uint32_t id );
 
 #endif //symbols_h
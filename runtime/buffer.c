@@ -19,12 +19,17 @@
 // 3. This notice may not be removed or altered from any source distribution.
 
 #include "buffer.h"
+#include <assert.h>
+#include <stdlib.h>
 #include <string.h>
 #include "closures.h"
 #include "exceptions.h"
 #include "symbols.h"
 #include "numbers.h"
+#include "fixints.h"
 #include "booleans.h"
+#include "sequences.h"
+#include "tuples.h"
 #include "macros.h"
 
 struct buffer *clone_buffer(
@@ -87,11 +92,40 @@ static value_t Buffer_iterator_next( PREFUNC, value_t iterator )
 	}
 }
 
+static value_t Buffer_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t buf = iterator->slots[0];
+	size_t offset = IntFromFixint( iterator->slots[1] );
+	size_t size = BUFFER(buf)->size;
+	if (limit > size - offset) {
+		limit = size - offset;
+	}
+	value_t items[BATCH_LIMIT];
+	for (size_t i = 0; i < limit; i++) {
+		items[i] = NumberFromInt( zone, BUFFER(buf)->bytes[offset + i] );
+	}
+	value_t rest = &Buffer_iterator_done;
+	if (offset + limit < size) {
+		struct closure *out = ALLOC( Buffer_iterator_function, 2 );
+		out->slots[0] = buf;
+		out->slots[1] = NumberFromInt( zone, offset + limit );
+		rest = out;
+	}
+	return MakeBatch( zone, items, limit, rest );
+}
+
 static value_t Buffer_iterator_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
 	DEFINE_METHOD(current, Buffer_iterator_current)
 	DEFINE_METHOD(next, Buffer_iterator_next)
+	DEFINE_METHOD(next_n, Buffer_iterator_next_n)
 	if (sym_is_valid == selector) return &True_returner;
 	return ThrowCStr( zone, "the buffer iterator does not have the requested method" );
 }
@@ -108,7 +142,7 @@ static value_t Buffer_iterator_done_function( PREFUNC, value_t parameter )
 static value_t Buffer_iterate( PREFUNC, value_t buf )
 {
 	ARGCHECK_1( buf );
-	if (BUFFER(self)->size) {
+	if (BUFFER(buf)->size) {
 		struct closure *out = ALLOC( Buffer_iterator_function, 2 );
 		out->slots[0] = buf;
 		out->slots[1] = num_zero;
@@ -119,15 +153,195 @@ static value_t Buffer_iterate( PREFUNC, value_t buf )
 	}
 }
 
+static value_t Buffer_size( PREFUNC, value_t buf )
+{
+	ARGCHECK_1( buf );
+	return NumberFromInt( zone, BUFFER(buf)->size );
+}
+
+static value_t Buffer_lookup( PREFUNC, value_t buf, value_t index )
+{
+	ARGCHECK_2( buf, index );
+	if (!IsAFixint( index )) {
+		return ThrowCStr( zone, "element index is not an integer" );
+	}
+	size_t offset = IntFromFixint( index );
+	if (offset >= BUFFER(buf)->size) {
+		return ThrowCStr( zone, "element index is out of bounds" );
+	}
+	return NumberFromInt( zone, BUFFER(buf)->bytes[offset] );
+}
+
+static value_t Buffer_slice( PREFUNC, value_t buf, value_t skip, value_t count )
+{
+	ARGCHECK_3( buf, skip, count );
+	size_t size = BUFFER(buf)->size;
+	size_t begin = 0, end = 0;
+	if (!SliceBounds( skip, count, size, &begin, &end )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	if (0 == begin && size == end) return buf;
+	const byte_t *bytes = BUFFER(buf)->bytes;
+	return (value_t)clone_buffer(
+			zone, (function_t)Buffer_function, end - begin, &bytes[begin] );
+}
+
 static value_t Buffer_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	// There's no technical reason the buffer could not have an index function
-	// as well as the iterate function, but the whole point of Radian is to do
-	// as much as possible in terms of sequences. I will leave the buffer as
-	// nothing but a sequence for now and consider adding more features later
-	// if appropriate.
+	// The buffer is first of all a sequence, but it also offers the
+	// random-access protocol, so that sequence utilities and the parallel
+	// engine can index into it instead of walking it.
 	DEFINE_METHOD(iterate, Buffer_iterate)
+	DEFINE_METHOD(size, Buffer_size)
+	DEFINE_METHOD(lookup, Buffer_lookup)
+	DEFINE_METHOD(slice, Buffer_slice)
+	return ThrowCStr( zone, "buffer object does not have that method" );
+}
+
+struct mapped_bytes
+{
+	const byte_t *base;
+	size_t length;
+};
+#define MAPPED(x) BUFDATA(x, struct mapped_bytes)
+
+static value_t Mapped_function( PREFUNC, value_t selector );
+
+value_t MappedBuffer( zone_t zone, const byte_t *base, size_t length )
+{
+	size_t size = sizeof(struct mapped_bytes);
+	struct buffer *out = BUFALLOC( Mapped_function, size );
+	MAPPED(out)->base = base;
+	MAPPED(out)->length = length;
+	return (value_t)out;
+}
+
+static value_t Mapped_size( PREFUNC, value_t buf )
+{
+	ARGCHECK_1( buf );
+	// A mapped file may be too large for its length to fit in a fixint, so
+	// its size, and the indexes of its later bytes, may be bigints.
+	return NumberFromSize( zone, MAPPED(buf)->length );
+}
+
+static value_t Mapped_lookup( PREFUNC, value_t buf, value_t index )
+{
+	ARGCHECK_2( buf, index );
+	if (!IsAnInteger( index )) {
+		return ThrowCStr( zone, "element index is not an integer" );
+	}
+	size_t offset = 0;
+	if (!SizeFromNumber( index, &offset ) || offset >= MAPPED(buf)->length) {
+		return ThrowCStr( zone, "element index is out of bounds" );
+	}
+	return NumberFromInt( zone, MAPPED(buf)->base[offset] );
+}
+
+static value_t Mapped_slice(
+		PREFUNC, value_t buf, value_t skip, value_t count )
+{
+	ARGCHECK_3( buf, skip, count );
+	// A slice of a mapping is another view of the same bytes.
+	size_t size = MAPPED(buf)->length;
+	size_t begin = 0, end = 0;
+	if (!SliceBounds( skip, count, size, &begin, &end )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	if (0 == begin && size == end) return buf;
+	return MappedBuffer( zone, &MAPPED(buf)->base[begin], end - begin );
+}
+
+static value_t Mapped_iterate( PREFUNC, value_t buf )
+{
+	ARGCHECK_1( buf );
+	return IndexIterator( zone, buf );
+}
+
+static value_t Mapped_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DEFINE_METHOD(iterate, Mapped_iterate)
+	DEFINE_METHOD(size, Mapped_size)
+	DEFINE_METHOD(lookup, Mapped_lookup)
+	DEFINE_METHOD(slice, Mapped_slice)
+	return ThrowCStr( zone, "buffer object does not have that method" );
+}
+
+#define VIEW_SLOT_COUNT 3
+#define VIEW_SOURCE_SLOT 0
+#define VIEW_OFFSET_SLOT 1
+#define VIEW_LENGTH_SLOT 2
+
+static value_t View_function( PREFUNC, value_t selector );
+
+value_t BufferView( zone_t zone, value_t source, size_t offset, size_t length )
+{
+	// Views of views refer directly to the underlying buffer.
+	if (source->function == (function_t)View_function) {
+		offset += IntFromFixint( source->slots[VIEW_OFFSET_SLOT] );
+		source = source->slots[VIEW_SOURCE_SLOT];
+	}
+	struct closure *out = ALLOC( View_function, VIEW_SLOT_COUNT );
+	out->slots[VIEW_SOURCE_SLOT] = source;
+	out->slots[VIEW_OFFSET_SLOT] = NumberFromInt( zone, offset );
+	out->slots[VIEW_LENGTH_SLOT] = NumberFromInt( zone, length );
+	return out;
+}
+
+static const byte_t *ViewBytes( value_t view )
+{
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	BufferBytes( view->slots[VIEW_SOURCE_SLOT], &bytes, &length );
+	return &bytes[IntFromFixint( view->slots[VIEW_OFFSET_SLOT] )];
+}
+
+static value_t View_size( PREFUNC, value_t view )
+{
+	ARGCHECK_1( view );
+	return view->slots[VIEW_LENGTH_SLOT];
+}
+
+static value_t View_lookup( PREFUNC, value_t view, value_t index )
+{
+	ARGCHECK_2( view, index );
+	if (!IsAFixint( index )) {
+		return ThrowCStr( zone, "element index is not an integer" );
+	}
+	size_t offset = IntFromFixint( index );
+	if (offset >= (size_t)IntFromFixint( view->slots[VIEW_LENGTH_SLOT] )) {
+		return ThrowCStr( zone, "element index is out of bounds" );
+	}
+	return NumberFromInt( zone, ViewBytes( view )[offset] );
+}
+
+static value_t View_slice(
+		PREFUNC, value_t view, value_t skip, value_t count )
+{
+	ARGCHECK_3( view, skip, count );
+	size_t size = IntFromFixint( view->slots[VIEW_LENGTH_SLOT] );
+	size_t begin = 0, end = 0;
+	if (!SliceBounds( skip, count, size, &begin, &end )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	if (0 == begin && size == end) return view;
+	return BufferView( zone, view, begin, end - begin );
+}
+
+static value_t View_iterate( PREFUNC, value_t view )
+{
+	ARGCHECK_1( view );
+	return IndexIterator( zone, view );
+}
+
+static value_t View_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DEFINE_METHOD(iterate, View_iterate)
+	DEFINE_METHOD(size, View_size)
+	DEFINE_METHOD(lookup, View_lookup)
+	DEFINE_METHOD(slice, View_slice)
 	return ThrowCStr( zone, "buffer object does not have that method" );
 }
 
@@ -136,3 +350,225 @@ struct buffer *Buffer( zone_t zone, size_t bytes )
 	return BUFALLOC( Buffer_function, bytes );
 }
 
+bool IsAByteBuffer( value_t it )
+{
+	return it && it->function == (function_t)Buffer_function;
+}
+
+bool BufferBytes( value_t it, const byte_t **bytes, size_t *length )
+{
+	if (IsAByteBuffer( it )) {
+		*bytes = BUFFER(it)->bytes;
+		*length = BUFFER(it)->size;
+		return true;
+	}
+	if (it && it->function == (function_t)Mapped_function) {
+		*bytes = MAPPED(it)->base;
+		*length = MAPPED(it)->length;
+		return true;
+	}
+	if (it && it->function == (function_t)View_function) {
+		*bytes = ViewBytes( it );
+		*length = IntFromFixint( it->slots[VIEW_LENGTH_SLOT] );
+		return true;
+	}
+	return false;
+}
+
+value_t BufferFromSequence( zone_t zone, value_t seq )
+{
+	const byte_t *bytes = NULL;
+	size_t size = 0;
+	if (BufferBytes( seq, &bytes, &size )) {
+		return seq;
+	}
+	// Gather the bytes on the heap, since we don't know how many there will
+	// be, then copy them into a buffer once the sequence ends.
+	struct byte_sink sink = {NULL, 0, 0};
+	struct byte_spans spans;
+	BeginByteSpans( &spans, seq );
+	const byte_t *src = NULL;
+	size_t length = 0;
+	while (NextByteSpan( zone, &spans, &src, &length )) {
+		SinkWrite( &sink, src, length );
+	}
+	EndByteSpans( &spans );
+	if (spans.error) {
+		free( sink.data );
+		return spans.error;
+	}
+	return BufferFromSink( zone, &sink );
+}
+
+void BeginByteSpans( struct byte_spans *spans, value_t seq )
+{
+	spans->seq = seq;
+	spans->iter = NULL;
+	spans->error = NULL;
+	spans->scratch = NULL;
+}
+
+static size_t PackByteBatch(
+		zone_t zone, struct byte_spans *spans, size_t used )
+{
+	// Fill the scratch block from the sequence's iterator, starting at the
+	// given offset, and return the new offset. We never ask for more elements
+	// than there is room for, so nothing is left over between calls.
+	size_t room = BYTE_SPAN_SCRATCH_SIZE - used;
+	value_t batch = NextBatch(
+			zone, spans->iter, room < BATCH_LIMIT ? room : BATCH_LIMIT );
+	if (IsAnException( batch )) {
+		spans->error = batch;
+		return used;
+	}
+	value_t items = TupleItem( batch, 0 );
+	size_t count = TupleSize( items );
+	if (0 == count) {
+		spans->iter = NULL;
+		return used;
+	}
+	for (size_t i = 0; i < count; i++) {
+		value_t item = TupleItem( items, i );
+		if (IsAnException( item )) {
+			spans->error = item;
+			return used;
+		}
+		int byte = IsAFixint( item ) ? IntFromFixint( item ) : -1;
+		if (byte < 0 || byte > 255) {
+			spans->error = ThrowCStr(
+					zone, "byte values must be numbers in the range 0..255" );
+			return used;
+		}
+		spans->scratch[used++] = (byte_t)byte;
+	}
+	spans->iter = TupleItem( batch, 1 );
+	return used;
+}
+
+bool NextByteSpan(
+		zone_t zone,
+		struct byte_spans *spans,
+		const byte_t **bytes,
+		size_t *length )
+{
+	if (spans->seq) {
+		value_t seq = spans->seq;
+		spans->seq = NULL;
+		if (BufferBytes( seq, bytes, length )) {
+			return *length > 0;
+		}
+		value_t iter = seq;
+		if (!IsAnException( seq )) {
+			iter = METHOD_0( seq, sym_iterate );
+		}
+		if (IsAnException( iter )) {
+			spans->error = iter;
+			return false;
+		}
+		spans->iter = iter;
+	}
+	if (!spans->iter || spans->error) {
+		return false;
+	}
+	if (!spans->scratch) {
+		spans->scratch = malloc( BYTE_SPAN_SCRATCH_SIZE );
+		assert( spans->scratch );
+	}
+	size_t used = 0;
+	while (spans->iter && !spans->error && used < BYTE_SPAN_SCRATCH_SIZE) {
+		used = PackByteBatch( zone, spans, used );
+	}
+	if (spans->error || 0 == used) {
+		return false;
+	}
+	*bytes = spans->scratch;
+	*length = used;
+	return true;
+}
+
+void EndByteSpans( struct byte_spans *spans )
+{
+	free( spans->scratch );
+	spans->scratch = NULL;
+	spans->seq = NULL;
+	spans->iter = NULL;
+}
+
+void SinkReserve( struct byte_sink *sink, size_t bytes )
+{
+	if (sink->length + bytes > sink->capacity) {
+		size_t capacity = sink->capacity ? sink->capacity : 4096;
+		while (sink->length + bytes > capacity) {
+			capacity *= 2;
+		}
+		sink->data = realloc( sink->data, capacity );
+		assert( sink->data );
+		sink->capacity = capacity;
+	}
+}
+
+void SinkWrite( struct byte_sink *sink, const byte_t *src, size_t length )
+{
+	SinkReserve( sink, length );
+	memcpy( &sink->data[sink->length], src, length );
+	sink->length += length;
+}
+
+value_t BufferFromSink( zone_t zone, struct byte_sink *sink )
+{
+	struct buffer *out = Buffer( zone, sink->length );
+	if (sink->length) {
+		memcpy( out->bytes, sink->data, sink->length );
+	}
+	free( sink->data );
+	return (value_t)out;
+}
+
+#if RUN_TESTS
+#include <sys/mman.h>
+
+static void test_mapped_sizes( zone_t zone )
+{
+	// A mapping larger than 2 GiB has a size, and indexes, which do not fit
+	// in a fixint. We need not back it with a real file: untouched anonymous
+	// pages read as zeros, and reserve no memory until they are touched.
+	if (sizeof(size_t) <= 4) return;
+	size_t length = (size_t)3 << 30;
+	int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+	void *base = mmap( NULL, length, PROT_READ, flags, -1, 0 );
+	if (MAP_FAILED == base) return;
+	value_t buf = MappedBuffer( zone, base, length );
+	size_t size = 0;
+	assert( SizeFromNumber( METHOD_0( buf, sym_size ), &size ) );
+	assert( size == length );
+
+	// Look up a byte beyond the range of a fixint, and one beyond the end.
+	value_t index = NumberFromSize( zone, ((size_t)1 << 31) + 5 );
+	value_t byte = METHOD_1( buf, sym_lookup, index );
+	assert( IsAFixint( byte ) && 0 == IntFromFixint( byte ) );
+	value_t end = NumberFromSize( zone, length );
+	assert( IsAnException( METHOD_1( buf, sym_lookup, end ) ) );
+
+	// Slice out a few bytes starting beyond the range of a fixint.
+	value_t count = NumberFromInt( zone, 10 );
+	value_t slice = METHOD_2( buf, sym_slice, index, count );
+	assert( !IsAnException( slice ) );
+	const byte_t *bytes = NULL;
+	assert( BufferBytes( slice, &bytes, &size ) && 10 == size );
+	assert( (const byte_t *)base + ((size_t)1 << 31) + 5 == bytes );
+
+	// An index iterator must accept the bigint size.
+	value_t iter = METHOD_0( buf, sym_iterate );
+	assert( !IsAnException( iter ) );
+	assert( BoolFromBoolean( zone, METHOD_0( iter, sym_is_valid ) ) );
+	munmap( base, length );
+}
+
+void test_buffers( zone_t zone )
+{
+	fprintf( stderr, "buffer tests begin:\n" );
+	test_mapped_sizes( zone );
+	fprintf( stderr, "...buffer tests done\n" );
+}
+
+#endif //RUN_TESTS
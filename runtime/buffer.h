@@ -22,7 +22,9 @@
 #ifndef buffer_h
 #define buffer_h
 
+#include "macros.h"
 #include "closures.h"
+#include <stdbool.h>
 
 struct buffer
 {
@@ -40,4 +42,68 @@ struct buffer *clone_buffer(
 struct buffer *alloc_buffer( zone_t zone, function_t function, size_t bytes );
 struct buffer *Buffer( zone_t zone, size_t bytes );
 
+// Byte buffers keep their contents in one contiguous run, so runtime code can
+// read them directly instead of iterating. BufferFromSequence returns the
+// value itself if it is already a byte buffer; any other sequence of numbers
+// in the range 0..255 is copied into a new buffer, and anything else produces
+// an exception.
+bool IsAByteBuffer( value_t it );
+bool BufferBytes( value_t it, const byte_t **bytes, size_t *length );
+value_t BufferFromSequence( zone_t zone, value_t seq );
+
+// A mapped buffer is a byte sequence whose contents live outside the zones,
+// typically in a memory-mapped file. The object itself is a small buffer
+// holding the address and length of the bytes, so the collector copies only
+// that header and never the contents. The bytes must outlive every object
+// which refers to them; since the collector has no finalizers, mappings made
+// for this purpose are never released. BufferBytes reads mapped buffers too.
+value_t MappedBuffer( zone_t zone, const byte_t *base, size_t length );
+
+// A buffer view is a run of bytes inside some other byte buffer, which it
+// keeps alive; making one copies nothing. BufferBytes reads views as well.
+value_t BufferView( zone_t zone, value_t source, size_t offset, size_t length );
+
+// Code which wants all the bytes of some sequence, such as a file writer, can
+// read them as a series of contiguous spans instead of one boxed number at a
+// time. A byte buffer yields its own storage as a single span. Any other
+// sequence of numbers in the range 0..255 is packed into a scratch block on
+// the heap, BYTE_SPAN_SCRATCH_SIZE bytes at a time, taking elements from its
+// iterator in batches where the iterator supports them. Each span is only
+// valid until the next call to NextByteSpan, and you must call EndByteSpans
+// when you are done. If the sequence fails, or contains something which is
+// not a byte, NextByteSpan returns false and leaves an exception in the
+// cursor's error field.
+#define BYTE_SPAN_SCRATCH_SIZE 65536
+struct byte_spans
+{
+	value_t seq;
+	value_t iter;
+	value_t error;
+	byte_t *scratch;
+};
+void BeginByteSpans( struct byte_spans *spans, value_t seq );
+bool NextByteSpan(
+		zone_t zone,
+		struct byte_spans *spans,
+		const byte_t **bytes,
+		size_t *length );
+void EndByteSpans( struct byte_spans *spans );
+
+// A byte sink accumulates output of unknown length on the heap. Start it out
+// zeroed; BufferFromSink copies the bytes into a new buffer and frees the heap
+// storage.
+struct byte_sink
+{
+	byte_t *data;
+	size_t length;
+	size_t capacity;
+};
+void SinkReserve( struct byte_sink *sink, size_t bytes );
+void SinkWrite( struct byte_sink *sink, const byte_t *src, size_t length );
+value_t BufferFromSink( zone_t zone, struct byte_sink *sink );
+
+#if RUN_TESTS
+void test_buffers( zone_t zone );
+#endif
+
 #endif //buffer_h
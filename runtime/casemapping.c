@@ -0,0 +1,161 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "casemapping.h"
+#include "casetables.h"
+#include "strings.h"
+#include "buffer.h"
+#include "atoms/stringliterals.h"
+#include "macros.h"
+#include "exceptions.h"
+
+
+// The library used to build these transformations out of three large maps,
+// constructed at startup from Radian modules, and look up each char in turn.
+// Now the mappings live in static two-stage tables: the high bits of a char
+// select a block of the table, and the low bits select an entry within it.
+// Most blocks contain no mappings at all and share a single identity block.
+// ASCII letters, which are most of what real text contains, never touch the
+// tables; we flip their case bit eight bytes at a time.
+
+#define ASCII_WORD_MASK 0x8080808080808080ULL
+#define REPEAT_BYTE(x) (0x0101010101010101ULL * (x))
+
+static uint64_t MapASCIIWord( uint64_t word, byte_t first, byte_t last )
+{
+	// Find the letters in a word of ASCII text and flip their case bit. Adding
+	// a constant to each byte sets its high bit if the byte was at or above
+	// some threshold; no byte can carry into its neighbour, since none of them
+	// had its high bit set to begin with.
+	uint64_t from_first = word + REPEAT_BYTE(0x80 - first);
+	uint64_t past_last = word + REPEAT_BYTE(0x7F - last);
+	uint64_t letters = from_first & ~past_last & ASCII_WORD_MASK;
+	return word ^ (letters >> 2);
+}
+
+static size_t MapASCII(
+		byte_t *dest,
+		const byte_t *src,
+		size_t length,
+		bool upper,
+		bool *changed )
+{
+	// Transform the run of ASCII text at the beginning of the source, and
+	// return its length.
+	byte_t first = upper ? 'a' : 'A';
+	byte_t last = upper ? 'z' : 'Z';
+	size_t i = 0;
+	while (i + sizeof(uint64_t) <= length) {
+		uint64_t word;
+		memcpy( &word, &src[i], sizeof(word) );
+		if (word & ASCII_WORD_MASK) break;
+		uint64_t mapped = MapASCIIWord( word, first, last );
+		*changed |= mapped != word;
+		memcpy( &dest[i], &mapped, sizeof(mapped) );
+		i += sizeof(word);
+	}
+	while (i < length && src[i] < 0x80) {
+		byte_t ch = src[i];
+		if (ch >= first && ch <= last) {
+			ch ^= 0x20;
+			*changed = true;
+		}
+		dest[i++] = ch;
+	}
+	return i;
+}
+
+static value_t MapCase(
+		zone_t zone, value_t str, const uint16_t *stage1, bool upper )
+{
+	struct byte_sink sink = {NULL, 0, 0};
+	bool changed = false;
+	struct string_chunks chunks;
+	BeginStringChunks( &chunks, str );
+	const byte_t *src = NULL;
+	size_t length = 0;
+	while (NextStringChunk( zone, &chunks, &src, &length )) {
+		size_t i = 0;
+		while (i < length) {
+			if (src[i] < 0x80) {
+				SinkReserve( &sink, length - i );
+				byte_t *dest = &sink.data[sink.length];
+				size_t run = MapASCII(
+						dest, &src[i], length - i, upper, &changed );
+				sink.length += run;
+				i += run;
+				continue;
+			}
+			// Chars without a mapping, and malformed sequences, go through
+			// exactly as they were.
+			size_t used = 0;
+			int ch = 0;
+			bool valid = DecodeUTF8Sequence( &src[i], length - i, &used, &ch );
+			const uint32_t *mapping = valid ? CaseMapping( stage1, ch ) : NULL;
+			if (mapping) {
+				SinkReserve( &sink, 12 );
+				for (int k = 0; k < 3 && mapping[k]; k++) {
+					byte_t *dest = &sink.data[sink.length];
+					sink.length += EncodeUTF8( mapping[k], dest );
+				}
+				changed = true;
+			} else {
+				SinkWrite( &sink, &src[i], used );
+			}
+			i += used;
+		}
+	}
+	EndStringChunks( &chunks );
+	if (chunks.error || !changed) {
+		free( sink.data );
+		return chunks.error ? chunks.error : str;
+	}
+	value_t out = StringFromUTF8Bytes(
+			zone, (const char*)sink.data, sink.length );
+	free( sink.data );
+	return out;
+}
+
+static value_t string_to_upper_function( PREFUNC, value_t str )
+{
+	ARGCHECK_1( str );
+	return MapCase( zone, str, case_stage1_upper, true );
+}
+const struct closure string_to_upper =
+		{(function_t)string_to_upper_function};
+
+static value_t string_to_lower_function( PREFUNC, value_t str )
+{
+	ARGCHECK_1( str );
+	return MapCase( zone, str, case_stage1_lower, false );
+}
+const struct closure string_to_lower =
+		{(function_t)string_to_lower_function};
+
+static value_t string_fold_case_function( PREFUNC, value_t str )
+{
+	ARGCHECK_1( str );
+	return MapCase( zone, str, case_stage1_foldcase, false );
+}
+const struct closure string_fold_case =
+		{(function_t)string_fold_case_function};
@@ -0,0 +1,35 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef casemapping_h
+#define casemapping_h
+
+#include "closures.h"
+
+// Builtin entrypoints for the string library's case transformations. These
+// apply the full Unicode case mappings, so one input char may become as many
+// as three output chars. The tables live in casetables.h, which the compiler
+// also uses to fold the case of identifiers.
+extern const struct closure string_to_upper;
+extern const struct closure string_to_lower;
+extern const struct closure string_fold_case;
+
+#endif //casemapping_h
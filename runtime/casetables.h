@@ -0,0 +1,2136 @@
+// runtime/casetables.h: generated by unicode/casetables.py from the
+// case mapping modules in library/. Do not edit by hand.
+
+#ifndef casetables_h
+#define casetables_h
+
+#include <stdint.h>
+
+#define CASE_BLOCK_BITS 7
+#define CASE_BLOCK_MASK ((1 << CASE_BLOCK_BITS) - 1)
+#define CASE_TABLE_LIMIT 0x10480
+
+static const uint16_t case_stage1_upper[] = {
+	1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0,
+	14, 15, 16, 17, 0, 0, 18, 19, 0, 0, 0, 0,
+	0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 21, 22, 23, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 0,
+	0, 0, 0, 0, 0, 0, 29, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 30,
+};
+
+static const uint16_t case_stage1_lower[] = {
+	31, 32, 33, 34, 35, 0, 36, 37, 38, 39, 40, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	42, 43, 44, 45, 0, 0, 46, 47, 0, 0, 0, 0,
+	0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 53, 54,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 56,
+};
+
+static const uint16_t case_stage1_foldcase[] = {
+	31, 57, 58, 59, 35, 0, 60, 61, 38, 39, 40, 62,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	42, 63, 64, 65, 0, 0, 46, 47, 0, 0, 0, 0,
+	0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 53, 54,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 0,
+	0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 56,
+};
+
+static const uint16_t case_blocks[][1 << CASE_BLOCK_BITS] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+		24, 25, 26, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28,
+		29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+		41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 0,
+		52, 53, 54, 55, 56, 57, 58, 59,
+	},
+	{
+		0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 65,
+		0, 66, 0, 67, 0, 68, 0, 69, 0, 70, 0, 71,
+		0, 72, 0, 73, 0, 74, 0, 75, 0, 76, 0, 77,
+		0, 78, 0, 79, 0, 80, 0, 81, 0, 82, 0, 83,
+		0, 9, 0, 84, 0, 85, 0, 86, 0, 0, 87, 0,
+		88, 0, 89, 0, 90, 0, 91, 0, 92, 0, 93, 0,
+		94, 95, 0, 96, 0, 97, 0, 98, 0, 99, 0, 100,
+		0, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106,
+		0, 107, 0, 108, 0, 109, 0, 110, 0, 111, 0, 112,
+		0, 113, 0, 114, 0, 115, 0, 116, 0, 117, 0, 118,
+		0, 0, 119, 0, 120, 0, 121, 19,
+	},
+	{
+		122, 0, 0, 123, 0, 124, 0, 0, 125, 0, 0, 0,
+		126, 0, 0, 0, 0, 0, 127, 0, 0, 128, 0, 0,
+		0, 129, 130, 0, 0, 0, 131, 0, 0, 132, 0, 133,
+		0, 134, 0, 0, 135, 0, 0, 0, 0, 136, 0, 0,
+		137, 0, 0, 0, 138, 0, 139, 0, 0, 140, 0, 0,
+		0, 141, 0, 142, 0, 0, 0, 0, 0, 143, 143, 0,
+		144, 144, 0, 145, 145, 0, 146, 0, 147, 0, 148, 0,
+		149, 0, 150, 0, 151, 0, 152, 0, 153, 154, 0, 155,
+		0, 156, 0, 157, 0, 158, 0, 159, 0, 160, 0, 161,
+		0, 162, 0, 163, 164, 0, 165, 165, 0, 166, 0, 0,
+		0, 167, 0, 168, 0, 169, 0, 170,
+	},
+	{
+		0, 171, 0, 172, 0, 173, 0, 174, 0, 175, 0, 176,
+		0, 177, 0, 178, 0, 179, 0, 180, 0, 181, 0, 182,
+		0, 183, 0, 184, 0, 185, 0, 186, 0, 0, 0, 187,
+		0, 188, 0, 189, 0, 190, 0, 191, 0, 192, 0, 193,
+		0, 194, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0,
+		196, 0, 0, 197, 198, 0, 199, 0, 0, 0, 0, 200,
+		0, 201, 0, 202, 0, 203, 0, 204, 205, 206, 207, 208,
+		209, 0, 210, 211, 0, 212, 0, 213, 0, 0, 0, 0,
+		214, 0, 0, 215, 0, 216, 217, 0, 218, 219, 0, 220,
+		0, 0, 0, 221, 0, 222, 223, 0, 0, 224, 0, 0,
+		0, 0, 0, 0, 0, 225, 0, 0,
+	},
+	{
+		226, 0, 0, 227, 0, 0, 0, 0, 228, 229, 230, 231,
+		232, 0, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 234, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 235, 0, 236, 0, 0, 0, 237,
+		0, 0, 0, 238, 239, 240, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 241, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 242, 243, 244, 245,
+		246, 247, 248, 249, 250, 251, 252, 253, 254, 234, 255, 256,
+		27, 257, 258, 259, 260, 261, 262, 262, 263, 264, 265, 266,
+		267, 268, 269, 270, 271, 272, 273, 0, 248, 254, 0, 0,
+		0, 265, 260, 274, 0, 275, 0, 276, 0, 277, 0, 278,
+		0, 279, 0, 280, 0, 281, 0, 282, 0, 283, 0, 284,
+		0, 285, 0, 286, 255, 261, 287, 0, 0, 251, 0, 0,
+		288, 0, 0, 289, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+		302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313,
+		314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325,
+		326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337,
+		0, 338, 0, 339, 0, 340, 0, 341, 0, 342, 0, 343,
+		0, 344, 0, 345, 0, 346, 0, 347, 0, 348, 0, 349,
+		0, 350, 0, 351, 0, 352, 0, 353,
+	},
+	{
+		0, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 355,
+		0, 356, 0, 357, 0, 358, 0, 359, 0, 360, 0, 361,
+		0, 362, 0, 363, 0, 364, 0, 365, 0, 366, 0, 367,
+		0, 368, 0, 369, 0, 370, 0, 371, 0, 372, 0, 373,
+		0, 374, 0, 375, 0, 376, 0, 377, 0, 378, 0, 379,
+		0, 380, 0, 381, 0, 0, 382, 0, 383, 0, 384, 0,
+		385, 0, 386, 0, 387, 0, 388, 389, 0, 390, 0, 391,
+		0, 392, 0, 393, 0, 394, 0, 395, 0, 396, 0, 397,
+		0, 398, 0, 399, 0, 400, 0, 401, 0, 402, 0, 403,
+		0, 404, 0, 405, 0, 406, 0, 407, 0, 408, 0, 409,
+		0, 410, 0, 411, 0, 412, 0, 413,
+	},
+	{
+		0, 414, 0, 415, 0, 416, 0, 417, 0, 418, 0, 419,
+		0, 420, 0, 421, 0, 422, 0, 423, 0, 424, 0, 425,
+		0, 426, 0, 427, 0, 428, 0, 429, 0, 430, 0, 431,
+		0, 432, 0, 433, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444,
+		445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456,
+		457, 458, 459, 460, 461, 462, 463, 464,
+	},
+	{
+		465, 466, 467, 468, 469, 470, 471, 472, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 473, 0, 0, 0, 474, 0, 0,
+	},
+	{
+		0, 475, 0, 476, 0, 477, 0, 478, 0, 479, 0, 480,
+		0, 481, 0, 482, 0, 483, 0, 484, 0, 485, 0, 486,
+		0, 487, 0, 488, 0, 489, 0, 490, 0, 491, 0, 492,
+		0, 493, 0, 494, 0, 495, 0, 496, 0, 497, 0, 498,
+		0, 499, 0, 500, 0, 501, 0, 502, 0, 503, 0, 504,
+		0, 505, 0, 506, 0, 507, 0, 508, 0, 509, 0, 510,
+		0, 511, 0, 512, 0, 513, 0, 514, 0, 515, 0, 516,
+		0, 517, 0, 518, 0, 519, 0, 520, 0, 521, 0, 522,
+		0, 523, 0, 524, 0, 525, 0, 526, 0, 527, 0, 528,
+		0, 529, 0, 530, 0, 531, 0, 532, 0, 533, 0, 534,
+		0, 535, 0, 536, 0, 537, 0, 538,
+	},
+	{
+		0, 539, 0, 540, 0, 541, 0, 542, 0, 543, 0, 544,
+		0, 545, 0, 546, 0, 547, 0, 548, 0, 549, 550, 551,
+		552, 553, 554, 523, 0, 0, 0, 0, 0, 555, 0, 556,
+		0, 557, 0, 558, 0, 559, 0, 560, 0, 561, 0, 562,
+		0, 563, 0, 564, 0, 565, 0, 566, 0, 567, 0, 568,
+		0, 569, 0, 570, 0, 571, 0, 572, 0, 573, 0, 574,
+		0, 575, 0, 576, 0, 577, 0, 578, 0, 579, 0, 580,
+		0, 581, 0, 582, 0, 583, 0, 584, 0, 585, 0, 586,
+		0, 587, 0, 588, 0, 589, 0, 590, 0, 591, 0, 592,
+		0, 593, 0, 594, 0, 595, 0, 596, 0, 597, 0, 598,
+		0, 599, 0, 600, 0, 601, 0, 602,
+	},
+	{
+		603, 604, 605, 606, 607, 608, 609, 610, 0, 0, 0, 0,
+		0, 0, 0, 0, 611, 612, 613, 614, 615, 616, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 617, 618, 619, 620,
+		621, 622, 623, 624, 0, 0, 0, 0, 0, 0, 0, 0,
+		625, 626, 627, 628, 629, 630, 631, 632, 0, 0, 0, 0,
+		0, 0, 0, 0, 633, 634, 635, 636, 637, 638, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 639, 640, 641, 642,
+		643, 644, 645, 646, 0, 0, 0, 0, 0, 0, 0, 0,
+		647, 648, 649, 650, 651, 652, 653, 654, 0, 0, 0, 0,
+		0, 0, 0, 0, 655, 656, 657, 658, 659, 660, 661, 662,
+		663, 664, 665, 666, 667, 668, 0, 0,
+	},
+	{
+		669, 670, 671, 672, 673, 674, 675, 676, 669, 670, 671, 672,
+		673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684,
+		677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688,
+		689, 690, 691, 692, 685, 686, 687, 688, 689, 690, 691, 692,
+		693, 694, 695, 696, 697, 0, 698, 699, 0, 0, 0, 0,
+		696, 0, 234, 0, 0, 0, 700, 701, 702, 0, 703, 704,
+		0, 0, 0, 0, 701, 0, 0, 0, 705, 706, 707, 241,
+		0, 0, 708, 709, 0, 0, 0, 0, 0, 0, 0, 0,
+		710, 711, 712, 246, 713, 714, 715, 716, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 717, 718, 719, 0, 720, 721,
+		0, 0, 0, 0, 718, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 722, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 723, 724, 725, 726, 727, 728, 729, 730,
+		731, 732, 733, 734, 735, 736, 737, 738,
+	},
+	{
+		0, 0, 0, 0, 739, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 740, 741, 742, 743,
+		744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755,
+		756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777,
+		778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789,
+		790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801,
+		802, 803, 804, 805, 806, 807, 808, 809, 810, 811, 812, 0,
+		0, 813, 0, 0, 0, 814, 815, 0, 816, 0, 817, 0,
+		818, 0, 0, 0, 0, 0, 0, 819, 0, 0, 820, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 821, 0, 822, 0, 823, 0, 824, 0, 825, 0, 826,
+		0, 827, 0, 828, 0, 829, 0, 830, 0, 831, 0, 832,
+		0, 833, 0, 834, 0, 835, 0, 836, 0, 837, 0, 838,
+		0, 839, 0, 840, 0, 841, 0, 842, 0, 843, 0, 844,
+		0, 845, 0, 846, 0, 847, 0, 848, 0, 849, 0, 850,
+		0, 851, 0, 852, 0, 853, 0, 854, 0, 855, 0, 856,
+		0, 857, 0, 858, 0, 859, 0, 860, 0, 861, 0, 862,
+		0, 863, 0, 864, 0, 865, 0, 866, 0, 867, 0, 868,
+		0, 869, 0, 870, 0, 0, 0, 0, 0, 0, 0, 0,
+		871, 0, 872, 0, 0, 0, 0, 873, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885,
+		886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897,
+		898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909,
+		910, 911, 0, 912, 0, 0, 0, 0, 0, 913, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 914, 0, 915, 0, 916, 0, 917,
+		0, 918, 0, 919, 0, 920, 0, 921, 0, 922, 0, 923,
+		0, 924, 0, 925, 0, 926, 0, 927, 0, 928, 0, 929,
+		0, 930, 0, 931, 0, 932, 0, 933, 0, 934, 0, 935,
+		0, 936, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 937, 0, 938, 0, 939, 0, 940, 0, 941, 0, 942,
+		0, 943, 0, 944, 0, 945, 0, 946, 0, 947, 0, 948,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 949,
+		0, 950, 0, 951, 0, 952, 0, 953, 0, 954, 0, 955,
+		0, 0, 0, 956, 0, 957, 0, 958, 0, 959, 0, 960,
+		0, 961, 0, 962, 0, 963, 0, 964, 0, 965, 0, 966,
+		0, 967, 0, 968, 0, 969, 0, 970, 0, 971, 0, 972,
+		0, 973, 0, 974, 0, 975, 0, 976, 0, 977, 0, 978,
+		0, 979, 0, 980, 0, 981, 0, 982, 0, 983, 0, 984,
+		0, 985, 0, 986, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 987, 0, 988, 0, 0, 989,
+	},
+	{
+		0, 990, 0, 991, 0, 992, 0, 993, 0, 0, 0, 0,
+		994, 0, 0, 0, 0, 995, 0, 996, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 997, 0, 998,
+		0, 999, 0, 1000, 0, 1001, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1002, 1003, 1004, 1005, 1006, 1007, 1007, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1008, 1009, 1010, 1011, 1012,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1013, 1014, 1015, 1016, 1017, 1018, 1019,
+		1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031,
+		1032, 1033, 1034, 1035, 1036, 1037, 1038, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046,
+		1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058,
+		1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+		1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
+		1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
+		1098, 1099, 1100, 1101, 1102, 1103, 1104, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+		1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+		1125, 1126, 1127, 0, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1135, 0, 1136, 0, 1137, 0, 1138, 0, 1139, 0, 1140, 0,
+		1141, 0, 1142, 0, 1143, 0, 1144, 0, 1145, 0, 1146, 0,
+		1147, 0, 1148, 0, 1149, 0, 1150, 0, 1151, 0, 1152, 0,
+		1153, 0, 1154, 0, 1155, 0, 1156, 0, 1157, 0, 1158, 0,
+		1159, 0, 1160, 0, 1161, 0, 1162, 0, 0, 1163, 0, 1164,
+		0, 1165, 0, 1166, 0, 1167, 0, 1168, 0, 1169, 0, 1170,
+		0, 0, 1171, 0, 1172, 0, 1173, 0, 1174, 0, 1175, 0,
+		1176, 0, 1177, 0, 1178, 0, 1179, 0, 1180, 0, 1181, 0,
+		1182, 0, 1183, 0, 1184, 0, 1185, 0, 1186, 0, 1187, 0,
+		1188, 0, 1189, 0, 1190, 0, 1191, 0, 1192, 0, 1193, 0,
+		1194, 1195, 0, 1196, 0, 1197, 0, 0,
+	},
+	{
+		0, 1198, 1199, 0, 1200, 0, 1201, 1202, 0, 1203, 1204, 1205,
+		0, 0, 1206, 1207, 1208, 1209, 0, 1210, 1211, 0, 1212, 1213,
+		1214, 0, 0, 0, 1215, 1216, 0, 1217, 1218, 0, 1219, 0,
+		1220, 0, 1221, 1222, 0, 1223, 0, 0, 1224, 0, 1225, 1226,
+		0, 1227, 1228, 1229, 0, 1230, 0, 1231, 1232, 0, 0, 0,
+		1233, 0, 0, 0, 0, 0, 0, 0, 1234, 1234, 0, 1235,
+		1235, 0, 1236, 1236, 0, 1237, 0, 1238, 0, 1239, 0, 1240,
+		0, 1241, 0, 1242, 0, 1243, 0, 1244, 0, 0, 1245, 0,
+		1246, 0, 1247, 0, 1248, 0, 1249, 0, 1250, 0, 1251, 0,
+		1252, 0, 1253, 0, 0, 1254, 1254, 0, 1255, 0, 1256, 1257,
+		1258, 0, 1259, 0, 1260, 0, 1261, 0,
+	},
+	{
+		1262, 0, 1263, 0, 1264, 0, 1265, 0, 1266, 0, 1267, 0,
+		1268, 0, 1269, 0, 1270, 0, 1271, 0, 1272, 0, 1273, 0,
+		1274, 0, 1275, 0, 1276, 0, 1277, 0, 1278, 0, 1279, 0,
+		1280, 0, 1281, 0, 1282, 0, 1283, 0, 1284, 0, 1285, 0,
+		1286, 0, 1287, 0, 0, 0, 0, 0, 0, 0, 1288, 1289,
+		0, 1290, 1291, 0, 0, 1292, 0, 1293, 1294, 1295, 1296, 0,
+		1297, 0, 1298, 0, 1299, 0, 1300, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1301, 0, 1302, 0, 0, 0, 1303, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 1304, 0, 1305, 1306, 1307, 0,
+		1308, 0, 1309, 1310, 0, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+		1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 0, 1328,
+		1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1337, 0, 0, 0, 0,
+		0, 0, 0, 0, 1338, 0, 1339, 0, 1340, 0, 1341, 0,
+		1342, 0, 1343, 0, 1344, 0, 1345, 0, 1346, 0, 1347, 0,
+		1348, 0, 1349, 0, 0, 0, 0, 0, 1318, 0, 0, 1350,
+		0, 1351, 1352, 0, 0, 1353, 1354, 1355,
+	},
+	{
+		1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367,
+		1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
+		1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+		1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1404, 0, 1405, 0, 1406, 0, 1407, 0, 1408, 0, 1409, 0,
+		1410, 0, 1411, 0, 1412, 0, 1413, 0, 1414, 0, 1415, 0,
+		1416, 0, 1417, 0, 1418, 0, 1419, 0,
+	},
+	{
+		1420, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1421, 0,
+		1422, 0, 1423, 0, 1424, 0, 1425, 0, 1426, 0, 1427, 0,
+		1428, 0, 1429, 0, 1430, 0, 1431, 0, 1432, 0, 1433, 0,
+		1434, 0, 1435, 0, 1436, 0, 1437, 0, 1438, 0, 1439, 0,
+		1440, 0, 1441, 0, 1442, 0, 1443, 0, 1444, 0, 1445, 0,
+		1446, 0, 1447, 0, 1448, 1449, 0, 1450, 0, 1451, 0, 1452,
+		0, 1453, 0, 1454, 0, 1455, 0, 0, 1456, 0, 1457, 0,
+		1458, 0, 1459, 0, 1460, 0, 1461, 0, 1462, 0, 1463, 0,
+		1464, 0, 1465, 0, 1466, 0, 1467, 0, 1468, 0, 1469, 0,
+		1470, 0, 1471, 0, 1472, 0, 1473, 0, 1474, 0, 1475, 0,
+		1476, 0, 1477, 0, 1478, 0, 1479, 0,
+	},
+	{
+		1480, 0, 1481, 0, 1482, 0, 1483, 0, 1484, 0, 1485, 0,
+		1486, 0, 1487, 0, 1488, 0, 1489, 0, 1490, 0, 1491, 0,
+		1492, 0, 1493, 0, 1494, 0, 1495, 0, 1496, 0, 1497, 0,
+		1498, 0, 1499, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510,
+		1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522,
+		1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
+		1535, 1536, 1537, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1538, 1539, 1540, 1541,
+		1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553,
+		1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565,
+		1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 0, 1576,
+		0, 0, 0, 0, 0, 1577, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1578, 0, 1579, 0, 1580, 0, 1581, 0, 1582, 0, 1583, 0,
+		1584, 0, 1585, 0, 1586, 0, 1587, 0, 1588, 0, 1589, 0,
+		1590, 0, 1591, 0, 1592, 0, 1593, 0, 1594, 0, 1595, 0,
+		1596, 0, 1597, 0, 1598, 0, 1599, 0, 1600, 0, 1601, 0,
+		1602, 0, 1603, 0, 1604, 0, 1605, 0, 1606, 0, 1607, 0,
+		1608, 0, 1609, 0, 1610, 0, 1611, 0, 1612, 0, 1613, 0,
+		1614, 0, 1615, 0, 1616, 0, 1617, 0, 1618, 0, 1619, 0,
+		1620, 0, 1621, 0, 1622, 0, 1623, 0, 1624, 0, 1625, 0,
+		1626, 0, 1627, 0, 1628, 0, 1629, 0, 1630, 0, 1631, 0,
+		1632, 0, 1633, 0, 1634, 0, 1635, 0, 1636, 0, 1637, 0,
+		1638, 0, 1639, 0, 1640, 0, 1641, 0,
+	},
+	{
+		1642, 0, 1643, 0, 1644, 0, 1645, 0, 1646, 0, 1647, 0,
+		1648, 0, 1649, 0, 1650, 0, 1651, 0, 1652, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1653, 0, 1654, 0, 1655, 0,
+		1656, 0, 1657, 0, 1658, 0, 1659, 0, 1660, 0, 1661, 0,
+		1662, 0, 1663, 0, 1664, 0, 1665, 0, 1666, 0, 1667, 0,
+		1668, 0, 1669, 0, 1670, 0, 1671, 0, 1672, 0, 1673, 0,
+		1674, 0, 1675, 0, 1676, 0, 1677, 0, 1678, 0, 1679, 0,
+		1680, 0, 1681, 0, 1682, 0, 1683, 0, 1684, 0, 1685, 0,
+		1686, 0, 1687, 0, 1688, 0, 1689, 0, 1690, 0, 1691, 0,
+		1692, 0, 1693, 0, 1694, 0, 1695, 0, 1696, 0, 1697, 0,
+		1698, 0, 1699, 0, 1700, 0, 1701, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 1702, 1703, 1704, 1705,
+		1706, 1707, 1708, 1709, 0, 0, 0, 0, 0, 0, 0, 0,
+		1710, 1711, 1712, 1713, 1714, 1715, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723,
+		0, 0, 0, 0, 0, 0, 0, 0, 1724, 1725, 1726, 1727,
+		1728, 1729, 1730, 1731, 0, 0, 0, 0, 0, 0, 0, 0,
+		1732, 1733, 1734, 1735, 1736, 1737, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1738, 0, 1739, 0, 1740, 0, 1741,
+		0, 0, 0, 0, 0, 0, 0, 0, 1742, 1743, 1744, 1745,
+		1746, 1747, 1748, 1749, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 1750, 1751, 1752, 1753,
+		1754, 1755, 1756, 1757, 0, 0, 0, 0, 0, 0, 0, 0,
+		1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 0, 0, 0, 0,
+		0, 0, 0, 0, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773,
+		0, 0, 0, 0, 0, 0, 0, 0, 1774, 1775, 1776, 1777,
+		1778, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1779, 1780, 1781, 1782, 1783, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1784, 1785, 1786, 1787, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 1788, 1789, 1790, 1791,
+		1792, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1793, 1794, 1795, 1796, 1797, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 1334, 0, 0, 0, 1089, 1110, 0, 0, 0, 0,
+		0, 0, 1798, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810,
+		1811, 1812, 1813, 1814, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 1815, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1816, 1817, 1818, 1819, 1820, 1821,
+		1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833,
+		1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853,
+		1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865,
+		1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+		1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		1889, 0, 1890, 1891, 1892, 0, 0, 1893, 0, 1894, 0, 1895,
+		0, 1896, 1897, 1898, 1899, 0, 1900, 0, 0, 1901, 0, 0,
+		0, 0, 0, 0, 0, 0, 1902, 1903,
+	},
+	{
+		1904, 0, 1905, 0, 1906, 0, 1907, 0, 1908, 0, 1909, 0,
+		1910, 0, 1911, 0, 1912, 0, 1913, 0, 1914, 0, 1915, 0,
+		1916, 0, 1917, 0, 1918, 0, 1919, 0, 1920, 0, 1921, 0,
+		1922, 0, 1923, 0, 1924, 0, 1925, 0, 1926, 0, 1927, 0,
+		1928, 0, 1929, 0, 1930, 0, 1931, 0, 1932, 0, 1933, 0,
+		1934, 0, 1935, 0, 1936, 0, 1937, 0, 1938, 0, 1939, 0,
+		1940, 0, 1941, 0, 1942, 0, 1943, 0, 1944, 0, 1945, 0,
+		1946, 0, 1947, 0, 1948, 0, 1949, 0, 1950, 0, 1951, 0,
+		1952, 0, 1953, 0, 0, 0, 0, 0, 0, 0, 0, 1954,
+		0, 1955, 0, 0, 0, 0, 1956, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1957, 0, 1958, 0, 1959, 0, 1960, 0,
+		1961, 0, 1962, 0, 1963, 0, 1964, 0, 1965, 0, 1966, 0,
+		1967, 0, 1968, 0, 1969, 0, 1970, 0, 1971, 0, 1972, 0,
+		1973, 0, 1974, 0, 1975, 0, 1976, 0, 1977, 0, 1978, 0,
+		1979, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1980, 0, 1981, 0, 1982, 0, 1983, 0, 1984, 0, 1985, 0,
+		1986, 0, 1987, 0, 1988, 0, 1989, 0, 1990, 0, 1991, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1992, 0,
+		1993, 0, 1994, 0, 1995, 0, 1996, 0, 1997, 0, 1998, 0,
+		0, 0, 1999, 0, 2000, 0, 2001, 0, 2002, 0, 2003, 0,
+		2004, 0, 2005, 0, 2006, 0, 2007, 0, 2008, 0, 2009, 0,
+		2010, 0, 2011, 0, 2012, 0, 2013, 0, 2014, 0, 2015, 0,
+		2016, 0, 2017, 0, 2018, 0, 2019, 0, 2020, 0, 2021, 0,
+		2022, 0, 2023, 0, 2024, 0, 2025, 0, 2026, 0, 2027, 0,
+		2028, 0, 2029, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 2030, 0, 2031, 0, 2032, 2033, 0,
+	},
+	{
+		2034, 0, 2035, 0, 2036, 0, 2037, 0, 0, 0, 0, 2038,
+		0, 2039, 0, 0, 2040, 0, 2041, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2042, 0, 2043, 0,
+		2044, 0, 2045, 0, 2046, 0, 2047, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 2048, 2049, 2050,
+		2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062,
+		2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085,
+		2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097,
+		2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
+		2110, 2111, 2112, 2113, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 1322, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112,
+		1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+		1125, 1126, 1127, 0, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 2114,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1135, 0, 1136, 0, 1137, 0, 1138, 0, 1139, 0, 1140, 0,
+		1141, 0, 1142, 0, 1143, 0, 1144, 0, 1145, 0, 1146, 0,
+		1147, 0, 1148, 0, 1149, 0, 1150, 0, 1151, 0, 1152, 0,
+		1153, 0, 1154, 0, 1155, 0, 1156, 0, 1157, 0, 1158, 0,
+		1159, 0, 1160, 0, 1161, 0, 1162, 0, 0, 1163, 0, 1164,
+		0, 1165, 0, 1166, 0, 1167, 0, 1168, 0, 1169, 0, 1170,
+		0, 2115, 1171, 0, 1172, 0, 1173, 0, 1174, 0, 1175, 0,
+		1176, 0, 1177, 0, 1178, 0, 1179, 0, 1180, 0, 1181, 0,
+		1182, 0, 1183, 0, 1184, 0, 1185, 0, 1186, 0, 1187, 0,
+		1188, 0, 1189, 0, 1190, 0, 1191, 0, 1192, 0, 1193, 0,
+		1194, 1195, 0, 1196, 0, 1197, 0, 1097,
+	},
+	{
+		0, 1198, 1199, 0, 1200, 0, 1201, 1202, 0, 1203, 1204, 1205,
+		0, 0, 1206, 1207, 1208, 1209, 0, 1210, 1211, 0, 1212, 1213,
+		1214, 0, 0, 0, 1215, 1216, 0, 1217, 1218, 0, 1219, 0,
+		1220, 0, 1221, 1222, 0, 1223, 0, 0, 1224, 0, 1225, 1226,
+		0, 1227, 1228, 1229, 0, 1230, 0, 1231, 1232, 0, 0, 0,
+		1233, 0, 0, 0, 0, 0, 0, 0, 1234, 1234, 0, 1235,
+		1235, 0, 1236, 1236, 0, 1237, 0, 1238, 0, 1239, 0, 1240,
+		0, 1241, 0, 1242, 0, 1243, 0, 1244, 0, 0, 1245, 0,
+		1246, 0, 1247, 0, 1248, 0, 1249, 0, 1250, 0, 1251, 0,
+		1252, 0, 1253, 0, 2116, 1254, 1254, 0, 1255, 0, 1256, 1257,
+		1258, 0, 1259, 0, 1260, 0, 1261, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 1319, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1301, 0, 1302, 0, 0, 0, 1303, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 1304, 0, 1305, 1306, 1307, 0,
+		1308, 0, 1309, 1310, 2117, 1311, 1312, 1313, 1314, 1315, 1316, 1317,
+		1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 0, 1328,
+		1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 0, 0, 0, 0,
+		2118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 1328, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 1337, 1312, 1318, 0, 0,
+		0, 1331, 1326, 0, 1338, 0, 1339, 0, 1340, 0, 1341, 0,
+		1342, 0, 1343, 0, 1344, 0, 1345, 0, 1346, 0, 1347, 0,
+		1348, 0, 1349, 0, 1320, 1327, 0, 0, 1318, 1315, 0, 1350,
+		0, 1351, 1352, 0, 0, 1353, 1354, 1355,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 2119, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1642, 0, 1643, 0, 1644, 0, 1645, 0, 1646, 0, 1647, 0,
+		1648, 0, 1649, 0, 1650, 0, 1651, 0, 1652, 0, 2120, 2121,
+		2122, 2123, 2124, 1626, 0, 0, 2114, 0, 1654, 0, 1655, 0,
+		1656, 0, 1657, 0, 1658, 0, 1659, 0, 1660, 0, 1661, 0,
+		1662, 0, 1663, 0, 1664, 0, 1665, 0, 1666, 0, 1667, 0,
+		1668, 0, 1669, 0, 1670, 0, 1671, 0, 1672, 0, 1673, 0,
+		1674, 0, 1675, 0, 1676, 0, 1677, 0, 1678, 0, 1679, 0,
+		1680, 0, 1681, 0, 1682, 0, 1683, 0, 1684, 0, 1685, 0,
+		1686, 0, 1687, 0, 1688, 0, 1689, 0, 1690, 0, 1691, 0,
+		1692, 0, 1693, 0, 1694, 0, 1695, 0, 1696, 0, 1697, 0,
+		1698, 0, 1699, 0, 1700, 0, 1701, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 1702, 1703, 1704, 1705,
+		1706, 1707, 1708, 1709, 0, 0, 0, 0, 0, 0, 0, 0,
+		1710, 1711, 1712, 1713, 1714, 1715, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723,
+		0, 0, 0, 0, 0, 0, 0, 0, 1724, 1725, 1726, 1727,
+		1728, 1729, 1730, 1731, 0, 0, 0, 0, 0, 0, 0, 0,
+		1732, 1733, 1734, 1735, 1736, 1737, 0, 0, 2125, 0, 2126, 0,
+		2127, 0, 2128, 0, 0, 1738, 0, 1739, 0, 1740, 0, 1741,
+		0, 0, 0, 0, 0, 0, 0, 0, 1742, 1743, 1744, 1745,
+		1746, 1747, 1748, 1749, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2129, 2130, 2131, 2132,
+		2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144,
+		2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148,
+		2149, 2150, 2151, 2152, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152,
+		0, 0, 2153, 2154, 2155, 0, 2156, 2157, 1774, 1775, 1776, 1777,
+		2154, 0, 1319, 0, 0, 0, 2158, 2159, 2160, 0, 2161, 2162,
+		1779, 1780, 1781, 1782, 2159, 0, 0, 0, 0, 0, 2163, 2117,
+		0, 0, 2164, 2165, 1784, 1785, 1786, 1787, 0, 0, 0, 0,
+		0, 0, 2166, 2118, 2167, 0, 2168, 2169, 1788, 1789, 1790, 1791,
+		1792, 0, 0, 0, 0, 0, 2170, 2171, 2172, 0, 2173, 2174,
+		1793, 1794, 1795, 1796, 2171, 0, 0, 0,
+	},
+	{
+		2175, 2176, 2177, 2178, 2179, 2180, 2180, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 2181, 2182, 2183, 2184, 2185,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
+
+static const uint32_t case_mappings[][3] = {
+	{0x0000, 0x0000, 0x0000}, {0x0041, 0x0000, 0x0000},
+	{0x0042, 0x0000, 0x0000}, {0x0043, 0x0000, 0x0000},
+	{0x0044, 0x0000, 0x0000}, {0x0045, 0x0000, 0x0000},
+	{0x0046, 0x0000, 0x0000}, {0x0047, 0x0000, 0x0000},
+	{0x0048, 0x0000, 0x0000}, {0x0049, 0x0000, 0x0000},
+	{0x004A, 0x0000, 0x0000}, {0x004B, 0x0000, 0x0000},
+	{0x004C, 0x0000, 0x0000}, {0x004D, 0x0000, 0x0000},
+	{0x004E, 0x0000, 0x0000}, {0x004F, 0x0000, 0x0000},
+	{0x0050, 0x0000, 0x0000}, {0x0051, 0x0000, 0x0000},
+	{0x0052, 0x0000, 0x0000}, {0x0053, 0x0000, 0x0000},
+	{0x0054, 0x0000, 0x0000}, {0x0055, 0x0000, 0x0000},
+	{0x0056, 0x0000, 0x0000}, {0x0057, 0x0000, 0x0000},
+	{0x0058, 0x0000, 0x0000}, {0x0059, 0x0000, 0x0000},
+	{0x005A, 0x0000, 0x0000}, {0x039C, 0x0000, 0x0000},
+	{0x0053, 0x0053, 0x0000}, {0x00C0, 0x0000, 0x0000},
+	{0x00C1, 0x0000, 0x0000}, {0x00C2, 0x0000, 0x0000},
+	{0x00C3, 0x0000, 0x0000}, {0x00C4, 0x0000, 0x0000},
+	{0x00C5, 0x0000, 0x0000}, {0x00C6, 0x0000, 0x0000},
+	{0x00C7, 0x0000, 0x0000}, {0x00C8, 0x0000, 0x0000},
+	{0x00C9, 0x0000, 0x0000}, {0x00CA, 0x0000, 0x0000},
+	{0x00CB, 0x0000, 0x0000}, {0x00CC, 0x0000, 0x0000},
+	{0x00CD, 0x0000, 0x0000}, {0x00CE, 0x0000, 0x0000},
+	{0x00CF, 0x0000, 0x0000}, {0x00D0, 0x0000, 0x0000},
+	{0x00D1, 0x0000, 0x0000}, {0x00D2, 0x0000, 0x0000},
+	{0x00D3, 0x0000, 0x0000}, {0x00D4, 0x0000, 0x0000},
+	{0x00D5, 0x0000, 0x0000}, {0x00D6, 0x0000, 0x0000},
+	{0x00D8, 0x0000, 0x0000}, {0x00D9, 0x0000, 0x0000},
+	{0x00DA, 0x0000, 0x0000}, {0x00DB, 0x0000, 0x0000},
+	{0x00DC, 0x0000, 0x0000}, {0x00DD, 0x0000, 0x0000},
+	{0x00DE, 0x0000, 0x0000}, {0x0178, 0x0000, 0x0000},
+	{0x0100, 0x0000, 0x0000}, {0x0102, 0x0000, 0x0000},
+	{0x0104, 0x0000, 0x0000}, {0x0106, 0x0000, 0x0000},
+	{0x0108, 0x0000, 0x0000}, {0x010A, 0x0000, 0x0000},
+	{0x010C, 0x0000, 0x0000}, {0x010E, 0x0000, 0x0000},
+	{0x0110, 0x0000, 0x0000}, {0x0112, 0x0000, 0x0000},
+	{0x0114, 0x0000, 0x0000}, {0x0116, 0x0000, 0x0000},
+	{0x0118, 0x0000, 0x0000}, {0x011A, 0x0000, 0x0000},
+	{0x011C, 0x0000, 0x0000}, {0x011E, 0x0000, 0x0000},
+	{0x0120, 0x0000, 0x0000}, {0x0122, 0x0000, 0x0000},
+	{0x0124, 0x0000, 0x0000}, {0x0126, 0x0000, 0x0000},
+	{0x0128, 0x0000, 0x0000}, {0x012A, 0x0000, 0x0000},
+	{0x012C, 0x0000, 0x0000}, {0x012E, 0x0000, 0x0000},
+	{0x0132, 0x0000, 0x0000}, {0x0134, 0x0000, 0x0000},
+	{0x0136, 0x0000, 0x0000}, {0x0139, 0x0000, 0x0000},
+	{0x013B, 0x0000, 0x0000}, {0x013D, 0x0000, 0x0000},
+	{0x013F, 0x0000, 0x0000}, {0x0141, 0x0000, 0x0000},
+	{0x0143, 0x0000, 0x0000}, {0x0145, 0x0000, 0x0000},
+	{0x0147, 0x0000, 0x0000}, {0x02BC, 0x004E, 0x0000},
+	{0x014A, 0x0000, 0x0000}, {0x014C, 0x0000, 0x0000},
+	{0x014E, 0x0000, 0x0000}, {0x0150, 0x0000, 0x0000},
+	{0x0152, 0x0000, 0x0000}, {0x0154, 0x0000, 0x0000},
+	{0x0156, 0x0000, 0x0000}, {0x0158, 0x0000, 0x0000},
+	{0x015A, 0x0000, 0x0000}, {0x015C, 0x0000, 0x0000},
+	{0x015E, 0x0000, 0x0000}, {0x0160, 0x0000, 0x0000},
+	{0x0162, 0x0000, 0x0000}, {0x0164, 0x0000, 0x0000},
+	{0x0166, 0x0000, 0x0000}, {0x0168, 0x0000, 0x0000},
+	{0x016A, 0x0000, 0x0000}, {0x016C, 0x0000, 0x0000},
+	{0x016E, 0x0000, 0x0000}, {0x0170, 0x0000, 0x0000},
+	{0x0172, 0x0000, 0x0000}, {0x0174, 0x0000, 0x0000},
+	{0x0176, 0x0000, 0x0000}, {0x0179, 0x0000, 0x0000},
+	{0x017B, 0x0000, 0x0000}, {0x017D, 0x0000, 0x0000},
+	{0x0243, 0x0000, 0x0000}, {0x0182, 0x0000, 0x0000},
+	{0x0184, 0x0000, 0x0000}, {0x0187, 0x0000, 0x0000},
+	{0x018B, 0x0000, 0x0000}, {0x0191, 0x0000, 0x0000},
+	{0x01F6, 0x0000, 0x0000}, {0x0198, 0x0000, 0x0000},
+	{0x023D, 0x0000, 0x0000}, {0x0220, 0x0000, 0x0000},
+	{0x01A0, 0x0000, 0x0000}, {0x01A2, 0x0000, 0x0000},
+	{0x01A4, 0x0000, 0x0000}, {0x01A7, 0x0000, 0x0000},
+	{0x01AC, 0x0000, 0x0000}, {0x01AF, 0x0000, 0x0000},
+	{0x01B3, 0x0000, 0x0000}, {0x01B5, 0x0000, 0x0000},
+	{0x01B8, 0x0000, 0x0000}, {0x01BC, 0x0000, 0x0000},
+	{0x01F7, 0x0000, 0x0000}, {0x01C4, 0x0000, 0x0000},
+	{0x01C7, 0x0000, 0x0000}, {0x01CA, 0x0000, 0x0000},
+	{0x01CD, 0x0000, 0x0000}, {0x01CF, 0x0000, 0x0000},
+	{0x01D1, 0x0000, 0x0000}, {0x01D3, 0x0000, 0x0000},
+	{0x01D5, 0x0000, 0x0000}, {0x01D7, 0x0000, 0x0000},
+	{0x01D9, 0x0000, 0x0000}, {0x01DB, 0x0000, 0x0000},
+	{0x018E, 0x0000, 0x0000}, {0x01DE, 0x0000, 0x0000},
+	{0x01E0, 0x0000, 0x0000}, {0x01E2, 0x0000, 0x0000},
+	{0x01E4, 0x0000, 0x0000}, {0x01E6, 0x0000, 0x0000},
+	{0x01E8, 0x0000, 0x0000}, {0x01EA, 0x0000, 0x0000},
+	{0x01EC, 0x0000, 0x0000}, {0x01EE, 0x0000, 0x0000},
+	{0x004A, 0x030C, 0x0000}, {0x01F1, 0x0000, 0x0000},
+	{0x01F4, 0x0000, 0x0000}, {0x01F8, 0x0000, 0x0000},
+	{0x01FA, 0x0000, 0x0000}, {0x01FC, 0x0000, 0x0000},
+	{0x01FE, 0x0000, 0x0000}, {0x0200, 0x0000, 0x0000},
+	{0x0202, 0x0000, 0x0000}, {0x0204, 0x0000, 0x0000},
+	{0x0206, 0x0000, 0x0000}, {0x0208, 0x0000, 0x0000},
+	{0x020A, 0x0000, 0x0000}, {0x020C, 0x0000, 0x0000},
+	{0x020E, 0x0000, 0x0000}, {0x0210, 0x0000, 0x0000},
+	{0x0212, 0x0000, 0x0000}, {0x0214, 0x0000, 0x0000},
+	{0x0216, 0x0000, 0x0000}, {0x0218, 0x0000, 0x0000},
+	{0x021A, 0x0000, 0x0000}, {0x021C, 0x0000, 0x0000},
+	{0x021E, 0x0000, 0x0000}, {0x0222, 0x0000, 0x0000},
+	{0x0224, 0x0000, 0x0000}, {0x0226, 0x0000, 0x0000},
+	{0x0228, 0x0000, 0x0000}, {0x022A, 0x0000, 0x0000},
+	{0x022C, 0x0000, 0x0000}, {0x022E, 0x0000, 0x0000},
+	{0x0230, 0x0000, 0x0000}, {0x0232, 0x0000, 0x0000},
+	{0x023B, 0x0000, 0x0000}, {0x2C7E, 0x0000, 0x0000},
+	{0x2C7F, 0x0000, 0x0000}, {0x0241, 0x0000, 0x0000},
+	{0x0246, 0x0000, 0x0000}, {0x0248, 0x0000, 0x0000},
+	{0x024A, 0x0000, 0x0000}, {0x024C, 0x0000, 0x0000},
+	{0x024E, 0x0000, 0x0000}, {0x2C6F, 0x0000, 0x0000},
+	{0x2C6D, 0x0000, 0x0000}, {0x2C70, 0x0000, 0x0000},
+	{0x0181, 0x0000, 0x0000}, {0x0186, 0x0000, 0x0000},
+	{0x0189, 0x0000, 0x0000}, {0x018A, 0x0000, 0x0000},
+	{0x018F, 0x0000, 0x0000}, {0x0190, 0x0000, 0x0000},
+	{0x0193, 0x0000, 0x0000}, {0x0194, 0x0000, 0x0000},
+	{0xA78D, 0x0000, 0x0000}, {0xA7AA, 0x0000, 0x0000},
+	{0x0197, 0x0000, 0x0000}, {0x0196, 0x0000, 0x0000},
+	{0x2C62, 0x0000, 0x0000}, {0x019C, 0x0000, 0x0000},
+	{0x2C6E, 0x0000, 0x0000}, {0x019D, 0x0000, 0x0000},
+	{0x019F, 0x0000, 0x0000}, {0x2C64, 0x0000, 0x0000},
+	{0x01A6, 0x0000, 0x0000}, {0x01A9, 0x0000, 0x0000},
+	{0x01AE, 0x0000, 0x0000}, {0x0244, 0x0000, 0x0000},
+	{0x01B1, 0x0000, 0x0000}, {0x01B2, 0x0000, 0x0000},
+	{0x0245, 0x0000, 0x0000}, {0x01B7, 0x0000, 0x0000},
+	{0x0399, 0x0000, 0x0000}, {0x0370, 0x0000, 0x0000},
+	{0x0372, 0x0000, 0x0000}, {0x0376, 0x0000, 0x0000},
+	{0x03FD, 0x0000, 0x0000}, {0x03FE, 0x0000, 0x0000},
+	{0x03FF, 0x0000, 0x0000}, {0x0399, 0x0308, 0x0301},
+	{0x0386, 0x0000, 0x0000}, {0x0388, 0x0000, 0x0000},
+	{0x0389, 0x0000, 0x0000}, {0x038A, 0x0000, 0x0000},
+	{0x03A5, 0x0308, 0x0301}, {0x0391, 0x0000, 0x0000},
+	{0x0392, 0x0000, 0x0000}, {0x0393, 0x0000, 0x0000},
+	{0x0394, 0x0000, 0x0000}, {0x0395, 0x0000, 0x0000},
+	{0x0396, 0x0000, 0x0000}, {0x0397, 0x0000, 0x0000},
+	{0x0398, 0x0000, 0x0000}, {0x039A, 0x0000, 0x0000},
+	{0x039B, 0x0000, 0x0000}, {0x039D, 0x0000, 0x0000},
+	{0x039E, 0x0000, 0x0000}, {0x039F, 0x0000, 0x0000},
+	{0x03A0, 0x0000, 0x0000}, {0x03A1, 0x0000, 0x0000},
+	{0x03A3, 0x0000, 0x0000}, {0x03A4, 0x0000, 0x0000},
+	{0x03A5, 0x0000, 0x0000}, {0x03A6, 0x0000, 0x0000},
+	{0x03A7, 0x0000, 0x0000}, {0x03A8, 0x0000, 0x0000},
+	{0x03A9, 0x0000, 0x0000}, {0x03AA, 0x0000, 0x0000},
+	{0x03AB, 0x0000, 0x0000}, {0x038C, 0x0000, 0x0000},
+	{0x038E, 0x0000, 0x0000}, {0x038F, 0x0000, 0x0000},
+	{0x03CF, 0x0000, 0x0000}, {0x03D8, 0x0000, 0x0000},
+	{0x03DA, 0x0000, 0x0000}, {0x03DC, 0x0000, 0x0000},
+	{0x03DE, 0x0000, 0x0000}, {0x03E0, 0x0000, 0x0000},
+	{0x03E2, 0x0000, 0x0000}, {0x03E4, 0x0000, 0x0000},
+	{0x03E6, 0x0000, 0x0000}, {0x03E8, 0x0000, 0x0000},
+	{0x03EA, 0x0000, 0x0000}, {0x03EC, 0x0000, 0x0000},
+	{0x03EE, 0x0000, 0x0000}, {0x03F9, 0x0000, 0x0000},
+	{0x03F7, 0x0000, 0x0000}, {0x03FA, 0x0000, 0x0000},
+	{0x0410, 0x0000, 0x0000}, {0x0411, 0x0000, 0x0000},
+	{0x0412, 0x0000, 0x0000}, {0x0413, 0x0000, 0x0000},
+	{0x0414, 0x0000, 0x0000}, {0x0415, 0x0000, 0x0000},
+	{0x0416, 0x0000, 0x0000}, {0x0417, 0x0000, 0x0000},
+	{0x0418, 0x0000, 0x0000}, {0x0419, 0x0000, 0x0000},
+	{0x041A, 0x0000, 0x0000}, {0x041B, 0x0000, 0x0000},
+	{0x041C, 0x0000, 0x0000}, {0x041D, 0x0000, 0x0000},
+	{0x041E, 0x0000, 0x0000}, {0x041F, 0x0000, 0x0000},
+	{0x0420, 0x0000, 0x0000}, {0x0421, 0x0000, 0x0000},
+	{0x0422, 0x0000, 0x0000}, {0x0423, 0x0000, 0x0000},
+	{0x0424, 0x0000, 0x0000}, {0x0425, 0x0000, 0x0000},
+	{0x0426, 0x0000, 0x0000}, {0x0427, 0x0000, 0x0000},
+	{0x0428, 0x0000, 0x0000}, {0x0429, 0x0000, 0x0000},
+	{0x042A, 0x0000, 0x0000}, {0x042B, 0x0000, 0x0000},
+	{0x042C, 0x0000, 0x0000}, {0x042D, 0x0000, 0x0000},
+	{0x042E, 0x0000, 0x0000}, {0x042F, 0x0000, 0x0000},
+	{0x0400, 0x0000, 0x0000}, {0x0401, 0x0000, 0x0000},
+	{0x0402, 0x0000, 0x0000}, {0x0403, 0x0000, 0x0000},
+	{0x0404, 0x0000, 0x0000}, {0x0405, 0x0000, 0x0000},
+	{0x0406, 0x0000, 0x0000}, {0x0407, 0x0000, 0x0000},
+	{0x0408, 0x0000, 0x0000}, {0x0409, 0x0000, 0x0000},
+	{0x040A, 0x0000, 0x0000}, {0x040B, 0x0000, 0x0000},
+	{0x040C, 0x0000, 0x0000}, {0x040D, 0x0000, 0x0000},
+	{0x040E, 0x0000, 0x0000}, {0x040F, 0x0000, 0x0000},
+	{0x0460, 0x0000, 0x0000}, {0x0462, 0x0000, 0x0000},
+	{0x0464, 0x0000, 0x0000}, {0x0466, 0x0000, 0x0000},
+	{0x0468, 0x0000, 0x0000}, {0x046A, 0x0000, 0x0000},
+	{0x046C, 0x0000, 0x0000}, {0x046E, 0x0000, 0x0000},
+	{0x0470, 0x0000, 0x0000}, {0x0472, 0x0000, 0x0000},
+	{0x0474, 0x0000, 0x0000}, {0x0476, 0x0000, 0x0000},
+	{0x0478, 0x0000, 0x0000}, {0x047A, 0x0000, 0x0000},
+	{0x047C, 0x0000, 0x0000}, {0x047E, 0x0000, 0x0000},
+	{0x0480, 0x0000, 0x0000}, {0x048A, 0x0000, 0x0000},
+	{0x048C, 0x0000, 0x0000}, {0x048E, 0x0000, 0x0000},
+	{0x0490, 0x0000, 0x0000}, {0x0492, 0x0000, 0x0000},
+	{0x0494, 0x0000, 0x0000}, {0x0496, 0x0000, 0x0000},
+	{0x0498, 0x0000, 0x0000}, {0x049A, 0x0000, 0x0000},
+	{0x049C, 0x0000, 0x0000}, {0x049E, 0x0000, 0x0000},
+	{0x04A0, 0x0000, 0x0000}, {0x04A2, 0x0000, 0x0000},
+	{0x04A4, 0x0000, 0x0000}, {0x04A6, 0x0000, 0x0000},
+	{0x04A8, 0x0000, 0x0000}, {0x04AA, 0x0000, 0x0000},
+	{0x04AC, 0x0000, 0x0000}, {0x04AE, 0x0000, 0x0000},
+	{0x04B0, 0x0000, 0x0000}, {0x04B2, 0x0000, 0x0000},
+	{0x04B4, 0x0000, 0x0000}, {0x04B6, 0x0000, 0x0000},
+	{0x04B8, 0x0000, 0x0000}, {0x04BA, 0x0000, 0x0000},
+	{0x04BC, 0x0000, 0x0000}, {0x04BE, 0x0000, 0x0000},
+	{0x04C1, 0x0000, 0x0000}, {0x04C3, 0x0000, 0x0000},
+	{0x04C5, 0x0000, 0x0000}, {0x04C7, 0x0000, 0x0000},
+	{0x04C9, 0x0000, 0x0000}, {0x04CB, 0x0000, 0x0000},
+	{0x04CD, 0x0000, 0x0000}, {0x04C0, 0x0000, 0x0000},
+	{0x04D0, 0x0000, 0x0000}, {0x04D2, 0x0000, 0x0000},
+	{0x04D4, 0x0000, 0x0000}, {0x04D6, 0x0000, 0x0000},
+	{0x04D8, 0x0000, 0x0000}, {0x04DA, 0x0000, 0x0000},
+	{0x04DC, 0x0000, 0x0000}, {0x04DE, 0x0000, 0x0000},
+	{0x04E0, 0x0000, 0x0000}, {0x04E2, 0x0000, 0x0000},
+	{0x04E4, 0x0000, 0x0000}, {0x04E6, 0x0000, 0x0000},
+	{0x04E8, 0x0000, 0x0000}, {0x04EA, 0x0000, 0x0000},
+	{0x04EC, 0x0000, 0x0000}, {0x04EE, 0x0000, 0x0000},
+	{0x04F0, 0x0000, 0x0000}, {0x04F2, 0x0000, 0x0000},
+	{0x04F4, 0x0000, 0x0000}, {0x04F6, 0x0000, 0x0000},
+	{0x04F8, 0x0000, 0x0000}, {0x04FA, 0x0000, 0x0000},
+	{0x04FC, 0x0000, 0x0000}, {0x04FE, 0x0000, 0x0000},
+	{0x0500, 0x0000, 0x0000}, {0x0502, 0x0000, 0x0000},
+	{0x0504, 0x0000, 0x0000}, {0x0506, 0x0000, 0x0000},
+	{0x0508, 0x0000, 0x0000}, {0x050A, 0x0000, 0x0000},
+	{0x050C, 0x0000, 0x0000}, {0x050E, 0x0000, 0x0000},
+	{0x0510, 0x0000, 0x0000}, {0x0512, 0x0000, 0x0000},
+	{0x0514, 0x0000, 0x0000}, {0x0516, 0x0000, 0x0000},
+	{0x0518, 0x0000, 0x0000}, {0x051A, 0x0000, 0x0000},
+	{0x051C, 0x0000, 0x0000}, {0x051E, 0x0000, 0x0000},
+	{0x0520, 0x0000, 0x0000}, {0x0522, 0x0000, 0x0000},
+	{0x0524, 0x0000, 0x0000}, {0x0526, 0x0000, 0x0000},
+	{0x0531, 0x0000, 0x0000}, {0x0532, 0x0000, 0x0000},
+	{0x0533, 0x0000, 0x0000}, {0x0534, 0x0000, 0x0000},
+	{0x0535, 0x0000, 0x0000}, {0x0536, 0x0000, 0x0000},
+	{0x0537, 0x0000, 0x0000}, {0x0538, 0x0000, 0x0000},
+	{0x0539, 0x0000, 0x0000}, {0x053A, 0x0000, 0x0000},
+	{0x053B, 0x0000, 0x0000}, {0x053C, 0x0000, 0x0000},
+	{0x053D, 0x0000, 0x0000}, {0x053E, 0x0000, 0x0000},
+	{0x053F, 0x0000, 0x0000}, {0x0540, 0x0000, 0x0000},
+	{0x0541, 0x0000, 0x0000}, {0x0542, 0x0000, 0x0000},
+	{0x0543, 0x0000, 0x0000}, {0x0544, 0x0000, 0x0000},
+	{0x0545, 0x0000, 0x0000}, {0x0546, 0x0000, 0x0000},
+	{0x0547, 0x0000, 0x0000}, {0x0548, 0x0000, 0x0000},
+	{0x0549, 0x0000, 0x0000}, {0x054A, 0x0000, 0x0000},
+	{0x054B, 0x0000, 0x0000}, {0x054C, 0x0000, 0x0000},
+	{0x054D, 0x0000, 0x0000}, {0x054E, 0x0000, 0x0000},
+	{0x054F, 0x0000, 0x0000}, {0x0550, 0x0000, 0x0000},
+	{0x0551, 0x0000, 0x0000}, {0x0552, 0x0000, 0x0000},
+	{0x0553, 0x0000, 0x0000}, {0x0554, 0x0000, 0x0000},
+	{0x0555, 0x0000, 0x0000}, {0x0556, 0x0000, 0x0000},
+	{0x0535, 0x0552, 0x0000}, {0xA77D, 0x0000, 0x0000},
+	{0x2C63, 0x0000, 0x0000}, {0x1E00, 0x0000, 0x0000},
+	{0x1E02, 0x0000, 0x0000}, {0x1E04, 0x0000, 0x0000},
+	{0x1E06, 0x0000, 0x0000}, {0x1E08, 0x0000, 0x0000},
+	{0x1E0A, 0x0000, 0x0000}, {0x1E0C, 0x0000, 0x0000},
+	{0x1E0E, 0x0000, 0x0000}, {0x1E10, 0x0000, 0x0000},
+	{0x1E12, 0x0000, 0x0000}, {0x1E14, 0x0000, 0x0000},
+	{0x1E16, 0x0000, 0x0000}, {0x1E18, 0x0000, 0x0000},
+	{0x1E1A, 0x0000, 0x0000}, {0x1E1C, 0x0000, 0x0000},
+	{0x1E1E, 0x0000, 0x0000}, {0x1E20, 0x0000, 0x0000},
+	{0x1E22, 0x0000, 0x0000}, {0x1E24, 0x0000, 0x0000},
+	{0x1E26, 0x0000, 0x0000}, {0x1E28, 0x0000, 0x0000},
+	{0x1E2A, 0x0000, 0x0000}, {0x1E2C, 0x0000, 0x0000},
+	{0x1E2E, 0x0000, 0x0000}, {0x1E30, 0x0000, 0x0000},
+	{0x1E32, 0x0000, 0x0000}, {0x1E34, 0x0000, 0x0000},
+	{0x1E36, 0x0000, 0x0000}, {0x1E38, 0x0000, 0x0000},
+	{0x1E3A, 0x0000, 0x0000}, {0x1E3C, 0x0000, 0x0000},
+	{0x1E3E, 0x0000, 0x0000}, {0x1E40, 0x0000, 0x0000},
+	{0x1E42, 0x0000, 0x0000}, {0x1E44, 0x0000, 0x0000},
+	{0x1E46, 0x0000, 0x0000}, {0x1E48, 0x0000, 0x0000},
+	{0x1E4A, 0x0000, 0x0000}, {0x1E4C, 0x0000, 0x0000},
+	{0x1E4E, 0x0000, 0x0000}, {0x1E50, 0x0000, 0x0000},
+	{0x1E52, 0x0000, 0x0000}, {0x1E54, 0x0000, 0x0000},
+	{0x1E56, 0x0000, 0x0000}, {0x1E58, 0x0000, 0x0000},
+	{0x1E5A, 0x0000, 0x0000}, {0x1E5C, 0x0000, 0x0000},
+	{0x1E5E, 0x0000, 0x0000}, {0x1E60, 0x0000, 0x0000},
+	{0x1E62, 0x0000, 0x0000}, {0x1E64, 0x0000, 0x0000},
+	{0x1E66, 0x0000, 0x0000}, {0x1E68, 0x0000, 0x0000},
+	{0x1E6A, 0x0000, 0x0000}, {0x1E6C, 0x0000, 0x0000},
+	{0x1E6E, 0x0000, 0x0000}, {0x1E70, 0x0000, 0x0000},
+	{0x1E72, 0x0000, 0x0000}, {0x1E74, 0x0000, 0x0000},
+	{0x1E76, 0x0000, 0x0000}, {0x1E78, 0x0000, 0x0000},
+	{0x1E7A, 0x0000, 0x0000}, {0x1E7C, 0x0000, 0x0000},
+	{0x1E7E, 0x0000, 0x0000}, {0x1E80, 0x0000, 0x0000},
+	{0x1E82, 0x0000, 0x0000}, {0x1E84, 0x0000, 0x0000},
+	{0x1E86, 0x0000, 0x0000}, {0x1E88, 0x0000, 0x0000},
+	{0x1E8A, 0x0000, 0x0000}, {0x1E8C, 0x0000, 0x0000},
+	{0x1E8E, 0x0000, 0x0000}, {0x1E90, 0x0000, 0x0000},
+	{0x1E92, 0x0000, 0x0000}, {0x1E94, 0x0000, 0x0000},
+	{0x0048, 0x0331, 0x0000}, {0x0054, 0x0308, 0x0000},
+	{0x0057, 0x030A, 0x0000}, {0x0059, 0x030A, 0x0000},
+	{0x0041, 0x02BE, 0x0000}, {0x1EA0, 0x0000, 0x0000},
+	{0x1EA2, 0x0000, 0x0000}, {0x1EA4, 0x0000, 0x0000},
+	{0x1EA6, 0x0000, 0x0000}, {0x1EA8, 0x0000, 0x0000},
+	{0x1EAA, 0x0000, 0x0000}, {0x1EAC, 0x0000, 0x0000},
+	{0x1EAE, 0x0000, 0x0000}, {0x1EB0, 0x0000, 0x0000},
+	{0x1EB2, 0x0000, 0x0000}, {0x1EB4, 0x0000, 0x0000},
+	{0x1EB6, 0x0000, 0x0000}, {0x1EB8, 0x0000, 0x0000},
+	{0x1EBA, 0x0000, 0x0000}, {0x1EBC, 0x0000, 0x0000},
+	{0x1EBE, 0x0000, 0x0000}, {0x1EC0, 0x0000, 0x0000},
+	{0x1EC2, 0x0000, 0x0000}, {0x1EC4, 0x0000, 0x0000},
+	{0x1EC6, 0x0000, 0x0000}, {0x1EC8, 0x0000, 0x0000},
+	{0x1ECA, 0x0000, 0x0000}, {0x1ECC, 0x0000, 0x0000},
+	{0x1ECE, 0x0000, 0x0000}, {0x1ED0, 0x0000, 0x0000},
+	{0x1ED2, 0x0000, 0x0000}, {0x1ED4, 0x0000, 0x0000},
+	{0x1ED6, 0x0000, 0x0000}, {0x1ED8, 0x0000, 0x0000},
+	{0x1EDA, 0x0000, 0x0000}, {0x1EDC, 0x0000, 0x0000},
+	{0x1EDE, 0x0000, 0x0000}, {0x1EE0, 0x0000, 0x0000},
+	{0x1EE2, 0x0000, 0x0000}, {0x1EE4, 0x0000, 0x0000},
+	{0x1EE6, 0x0000, 0x0000}, {0x1EE8, 0x0000, 0x0000},
+	{0x1EEA, 0x0000, 0x0000}, {0x1EEC, 0x0000, 0x0000},
+	{0x1EEE, 0x0000, 0x0000}, {0x1EF0, 0x0000, 0x0000},
+	{0x1EF2, 0x0000, 0x0000}, {0x1EF4, 0x0000, 0x0000},
+	{0x1EF6, 0x0000, 0x0000}, {0x1EF8, 0x0000, 0x0000},
+	{0x1EFA, 0x0000, 0x0000}, {0x1EFC, 0x0000, 0x0000},
+	{0x1EFE, 0x0000, 0x0000}, {0x1F08, 0x0000, 0x0000},
+	{0x1F09, 0x0000, 0x0000}, {0x1F0A, 0x0000, 0x0000},
+	{0x1F0B, 0x0000, 0x0000}, {0x1F0C, 0x0000, 0x0000},
+	{0x1F0D, 0x0000, 0x0000}, {0x1F0E, 0x0000, 0x0000},
+	{0x1F0F, 0x0000, 0x0000}, {0x1F18, 0x0000, 0x0000},
+	{0x1F19, 0x0000, 0x0000}, {0x1F1A, 0x0000, 0x0000},
+	{0x1F1B, 0x0000, 0x0000}, {0x1F1C, 0x0000, 0x0000},
+	{0x1F1D, 0x0000, 0x0000}, {0x1F28, 0x0000, 0x0000},
+	{0x1F29, 0x0000, 0x0000}, {0x1F2A, 0x0000, 0x0000},
+	{0x1F2B, 0x0000, 0x0000}, {0x1F2C, 0x0000, 0x0000},
+	{0x1F2D, 0x0000, 0x0000}, {0x1F2E, 0x0000, 0x0000},
+	{0x1F2F, 0x0000, 0x0000}, {0x1F38, 0x0000, 0x0000},
+	{0x1F39, 0x0000, 0x0000}, {0x1F3A, 0x0000, 0x0000},
+	{0x1F3B, 0x0000, 0x0000}, {0x1F3C, 0x0000, 0x0000},
+	{0x1F3D, 0x0000, 0x0000}, {0x1F3E, 0x0000, 0x0000},
+	{0x1F3F, 0x0000, 0x0000}, {0x1F48, 0x0000, 0x0000},
+	{0x1F49, 0x0000, 0x0000}, {0x1F4A, 0x0000, 0x0000},
+	{0x1F4B, 0x0000, 0x0000}, {0x1F4C, 0x0000, 0x0000},
+	{0x1F4D, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0000},
+	{0x1F59, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0300},
+	{0x1F5B, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0301},
+	{0x1F5D, 0x0000, 0x0000}, {0x03A5, 0x0313, 0x0342},
+	{0x1F5F, 0x0000, 0x0000}, {0x1F68, 0x0000, 0x0000},
+	{0x1F69, 0x0000, 0x0000}, {0x1F6A, 0x0000, 0x0000},
+	{0x1F6B, 0x0000, 0x0000}, {0x1F6C, 0x0000, 0x0000},
+	{0x1F6D, 0x0000, 0x0000}, {0x1F6E, 0x0000, 0x0000},
+	{0x1F6F, 0x0000, 0x0000}, {0x1FBA, 0x0000, 0x0000},
+	{0x1FBB, 0x0000, 0x0000}, {0x1FC8, 0x0000, 0x0000},
+	{0x1FC9, 0x0000, 0x0000}, {0x1FCA, 0x0000, 0x0000},
+	{0x1FCB, 0x0000, 0x0000}, {0x1FDA, 0x0000, 0x0000},
+	{0x1FDB, 0x0000, 0x0000}, {0x1FF8, 0x0000, 0x0000},
+	{0x1FF9, 0x0000, 0x0000}, {0x1FEA, 0x0000, 0x0000},
+	{0x1FEB, 0x0000, 0x0000}, {0x1FFA, 0x0000, 0x0000},
+	{0x1FFB, 0x0000, 0x0000}, {0x1F08, 0x0399, 0x0000},
+	{0x1F09, 0x0399, 0x0000}, {0x1F0A, 0x0399, 0x0000},
+	{0x1F0B, 0x0399, 0x0000}, {0x1F0C, 0x0399, 0x0000},
+	{0x1F0D, 0x0399, 0x0000}, {0x1F0E, 0x0399, 0x0000},
+	{0x1F0F, 0x0399, 0x0000}, {0x1F28, 0x0399, 0x0000},
+	{0x1F29, 0x0399, 0x0000}, {0x1F2A, 0x0399, 0x0000},
+	{0x1F2B, 0x0399, 0x0000}, {0x1F2C, 0x0399, 0x0000},
+	{0x1F2D, 0x0399, 0x0000}, {0x1F2E, 0x0399, 0x0000},
+	{0x1F2F, 0x0399, 0x0000}, {0x1F68, 0x0399, 0x0000},
+	{0x1F69, 0x0399, 0x0000}, {0x1F6A, 0x0399, 0x0000},
+	{0x1F6B, 0x0399, 0x0000}, {0x1F6C, 0x0399, 0x0000},
+	{0x1F6D, 0x0399, 0x0000}, {0x1F6E, 0x0399, 0x0000},
+	{0x1F6F, 0x0399, 0x0000}, {0x1FB8, 0x0000, 0x0000},
+	{0x1FB9, 0x0000, 0x0000}, {0x1FBA, 0x0399, 0x0000},
+	{0x0391, 0x0399, 0x0000}, {0x0386, 0x0399, 0x0000},
+	{0x0391, 0x0342, 0x0000}, {0x0391, 0x0342, 0x0399},
+	{0x1FCA, 0x0399, 0x0000}, {0x0397, 0x0399, 0x0000},
+	{0x0389, 0x0399, 0x0000}, {0x0397, 0x0342, 0x0000},
+	{0x0397, 0x0342, 0x0399}, {0x1FD8, 0x0000, 0x0000},
+	{0x1FD9, 0x0000, 0x0000}, {0x0399, 0x0308, 0x0300},
+	{0x0399, 0x0342, 0x0000}, {0x0399, 0x0308, 0x0342},
+	{0x1FE8, 0x0000, 0x0000}, {0x1FE9, 0x0000, 0x0000},
+	{0x03A5, 0x0308, 0x0300}, {0x03A1, 0x0313, 0x0000},
+	{0x1FEC, 0x0000, 0x0000}, {0x03A5, 0x0342, 0x0000},
+	{0x03A5, 0x0308, 0x0342}, {0x1FFA, 0x0399, 0x0000},
+	{0x03A9, 0x0399, 0x0000}, {0x038F, 0x0399, 0x0000},
+	{0x03A9, 0x0342, 0x0000}, {0x03A9, 0x0342, 0x0399},
+	{0x2132, 0x0000, 0x0000}, {0x2160, 0x0000, 0x0000},
+	{0x2161, 0x0000, 0x0000}, {0x2162, 0x0000, 0x0000},
+	{0x2163, 0x0000, 0x0000}, {0x2164, 0x0000, 0x0000},
+	{0x2165, 0x0000, 0x0000}, {0x2166, 0x0000, 0x0000},
+	{0x2167, 0x0000, 0x0000}, {0x2168, 0x0000, 0x0000},
+	{0x2169, 0x0000, 0x0000}, {0x216A, 0x0000, 0x0000},
+	{0x216B, 0x0000, 0x0000}, {0x216C, 0x0000, 0x0000},
+	{0x216D, 0x0000, 0x0000}, {0x216E, 0x0000, 0x0000},
+	{0x216F, 0x0000, 0x0000}, {0x2183, 0x0000, 0x0000},
+	{0x24B6, 0x0000, 0x0000}, {0x24B7, 0x0000, 0x0000},
+	{0x24B8, 0x0000, 0x0000}, {0x24B9, 0x0000, 0x0000},
+	{0x24BA, 0x0000, 0x0000}, {0x24BB, 0x0000, 0x0000},
+	{0x24BC, 0x0000, 0x0000}, {0x24BD, 0x0000, 0x0000},
+	{0x24BE, 0x0000, 0x0000}, {0x24BF, 0x0000, 0x0000},
+	{0x24C0, 0x0000, 0x0000}, {0x24C1, 0x0000, 0x0000},
+	{0x24C2, 0x0000, 0x0000}, {0x24C3, 0x0000, 0x0000},
+	{0x24C4, 0x0000, 0x0000}, {0x24C5, 0x0000, 0x0000},
+	{0x24C6, 0x0000, 0x0000}, {0x24C7, 0x0000, 0x0000},
+	{0x24C8, 0x0000, 0x0000}, {0x24C9, 0x0000, 0x0000},
+	{0x24CA, 0x0000, 0x0000}, {0x24CB, 0x0000, 0x0000},
+	{0x24CC, 0x0000, 0x0000}, {0x24CD, 0x0000, 0x0000},
+	{0x24CE, 0x0000, 0x0000}, {0x24CF, 0x0000, 0x0000},
+	{0x2C00, 0x0000, 0x0000}, {0x2C01, 0x0000, 0x0000},
+	{0x2C02, 0x0000, 0x0000}, {0x2C03, 0x0000, 0x0000},
+	{0x2C04, 0x0000, 0x0000}, {0x2C05, 0x0000, 0x0000},
+	{0x2C06, 0x0000, 0x0000}, {0x2C07, 0x0000, 0x0000},
+	{0x2C08, 0x0000, 0x0000}, {0x2C09, 0x0000, 0x0000},
+	{0x2C0A, 0x0000, 0x0000}, {0x2C0B, 0x0000, 0x0000},
+	{0x2C0C, 0x0000, 0x0000}, {0x2C0D, 0x0000, 0x0000},
+	{0x2C0E, 0x0000, 0x0000}, {0x2C0F, 0x0000, 0x0000},
+	{0x2C10, 0x0000, 0x0000}, {0x2C11, 0x0000, 0x0000},
+	{0x2C12, 0x0000, 0x0000}, {0x2C13, 0x0000, 0x0000},
+	{0x2C14, 0x0000, 0x0000}, {0x2C15, 0x0000, 0x0000},
+	{0x2C16, 0x0000, 0x0000}, {0x2C17, 0x0000, 0x0000},
+	{0x2C18, 0x0000, 0x0000}, {0x2C19, 0x0000, 0x0000},
+	{0x2C1A, 0x0000, 0x0000}, {0x2C1B, 0x0000, 0x0000},
+	{0x2C1C, 0x0000, 0x0000}, {0x2C1D, 0x0000, 0x0000},
+	{0x2C1E, 0x0000, 0x0000}, {0x2C1F, 0x0000, 0x0000},
+	{0x2C20, 0x0000, 0x0000}, {0x2C21, 0x0000, 0x0000},
+	{0x2C22, 0x0000, 0x0000}, {0x2C23, 0x0000, 0x0000},
+	{0x2C24, 0x0000, 0x0000}, {0x2C25, 0x0000, 0x0000},
+	{0x2C26, 0x0000, 0x0000}, {0x2C27, 0x0000, 0x0000},
+	{0x2C28, 0x0000, 0x0000}, {0x2C29, 0x0000, 0x0000},
+	{0x2C2A, 0x0000, 0x0000}, {0x2C2B, 0x0000, 0x0000},
+	{0x2C2C, 0x0000, 0x0000}, {0x2C2D, 0x0000, 0x0000},
+	{0x2C2E, 0x0000, 0x0000}, {0x2C60, 0x0000, 0x0000},
+	{0x023A, 0x0000, 0x0000}, {0x023E, 0x0000, 0x0000},
+	{0x2C67, 0x0000, 0x0000}, {0x2C69, 0x0000, 0x0000},
+	{0x2C6B, 0x0000, 0x0000}, {0x2C72, 0x0000, 0x0000},
+	{0x2C75, 0x0000, 0x0000}, {0x2C80, 0x0000, 0x0000},
+	{0x2C82, 0x0000, 0x0000}, {0x2C84, 0x0000, 0x0000},
+	{0x2C86, 0x0000, 0x0000}, {0x2C88, 0x0000, 0x0000},
+	{0x2C8A, 0x0000, 0x0000}, {0x2C8C, 0x0000, 0x0000},
+	{0x2C8E, 0x0000, 0x0000}, {0x2C90, 0x0000, 0x0000},
+	{0x2C92, 0x0000, 0x0000}, {0x2C94, 0x0000, 0x0000},
+	{0x2C96, 0x0000, 0x0000}, {0x2C98, 0x0000, 0x0000},
+	{0x2C9A, 0x0000, 0x0000}, {0x2C9C, 0x0000, 0x0000},
+	{0x2C9E, 0x0000, 0x0000}, {0x2CA0, 0x0000, 0x0000},
+	{0x2CA2, 0x0000, 0x0000}, {0x2CA4, 0x0000, 0x0000},
+	{0x2CA6, 0x0000, 0x0000}, {0x2CA8, 0x0000, 0x0000},
+	{0x2CAA, 0x0000, 0x0000}, {0x2CAC, 0x0000, 0x0000},
+	{0x2CAE, 0x0000, 0x0000}, {0x2CB0, 0x0000, 0x0000},
+	{0x2CB2, 0x0000, 0x0000}, {0x2CB4, 0x0000, 0x0000},
+	{0x2CB6, 0x0000, 0x0000}, {0x2CB8, 0x0000, 0x0000},
+	{0x2CBA, 0x0000, 0x0000}, {0x2CBC, 0x0000, 0x0000},
+	{0x2CBE, 0x0000, 0x0000}, {0x2CC0, 0x0000, 0x0000},
+	{0x2CC2, 0x0000, 0x0000}, {0x2CC4, 0x0000, 0x0000},
+	{0x2CC6, 0x0000, 0x0000}, {0x2CC8, 0x0000, 0x0000},
+	{0x2CCA, 0x0000, 0x0000}, {0x2CCC, 0x0000, 0x0000},
+	{0x2CCE, 0x0000, 0x0000}, {0x2CD0, 0x0000, 0x0000},
+	{0x2CD2, 0x0000, 0x0000}, {0x2CD4, 0x0000, 0x0000},
+	{0x2CD6, 0x0000, 0x0000}, {0x2CD8, 0x0000, 0x0000},
+	{0x2CDA, 0x0000, 0x0000}, {0x2CDC, 0x0000, 0x0000},
+	{0x2CDE, 0x0000, 0x0000}, {0x2CE0, 0x0000, 0x0000},
+	{0x2CE2, 0x0000, 0x0000}, {0x2CEB, 0x0000, 0x0000},
+	{0x2CED, 0x0000, 0x0000}, {0x2CF2, 0x0000, 0x0000},
+	{0x10A0, 0x0000, 0x0000}, {0x10A1, 0x0000, 0x0000},
+	{0x10A2, 0x0000, 0x0000}, {0x10A3, 0x0000, 0x0000},
+	{0x10A4, 0x0000, 0x0000}, {0x10A5, 0x0000, 0x0000},
+	{0x10A6, 0x0000, 0x0000}, {0x10A7, 0x0000, 0x0000},
+	{0x10A8, 0x0000, 0x0000}, {0x10A9, 0x0000, 0x0000},
+	{0x10AA, 0x0000, 0x0000}, {0x10AB, 0x0000, 0x0000},
+	{0x10AC, 0x0000, 0x0000}, {0x10AD, 0x0000, 0x0000},
+	{0x10AE, 0x0000, 0x0000}, {0x10AF, 0x0000, 0x0000},
+	{0x10B0, 0x0000, 0x0000}, {0x10B1, 0x0000, 0x0000},
+	{0x10B2, 0x0000, 0x0000}, {0x10B3, 0x0000, 0x0000},
+	{0x10B4, 0x0000, 0x0000}, {0x10B5, 0x0000, 0x0000},
+	{0x10B6, 0x0000, 0x0000}, {0x10B7, 0x0000, 0x0000},
+	{0x10B8, 0x0000, 0x0000}, {0x10B9, 0x0000, 0x0000},
+	{0x10BA, 0x0000, 0x0000}, {0x10BB, 0x0000, 0x0000},
+	{0x10BC, 0x0000, 0x0000}, {0x10BD, 0x0000, 0x0000},
+	{0x10BE, 0x0000, 0x0000}, {0x10BF, 0x0000, 0x0000},
+	{0x10C0, 0x0000, 0x0000}, {0x10C1, 0x0000, 0x0000},
+	{0x10C2, 0x0000, 0x0000}, {0x10C3, 0x0000, 0x0000},
+	{0x10C4, 0x0000, 0x0000}, {0x10C5, 0x0000, 0x0000},
+	{0x10C7, 0x0000, 0x0000}, {0x10CD, 0x0000, 0x0000},
+	{0xA640, 0x0000, 0x0000}, {0xA642, 0x0000, 0x0000},
+	{0xA644, 0x0000, 0x0000}, {0xA646, 0x0000, 0x0000},
+	{0xA648, 0x0000, 0x0000}, {0xA64A, 0x0000, 0x0000},
+	{0xA64C, 0x0000, 0x0000}, {0xA64E, 0x0000, 0x0000},
+	{0xA650, 0x0000, 0x0000}, {0xA652, 0x0000, 0x0000},
+	{0xA654, 0x0000, 0x0000}, {0xA656, 0x0000, 0x0000},
+	{0xA658, 0x0000, 0x0000}, {0xA65A, 0x0000, 0x0000},
+	{0xA65C, 0x0000, 0x0000}, {0xA65E, 0x0000, 0x0000},
+	{0xA660, 0x0000, 0x0000}, {0xA662, 0x0000, 0x0000},
+	{0xA664, 0x0000, 0x0000}, {0xA666, 0x0000, 0x0000},
+	{0xA668, 0x0000, 0x0000}, {0xA66A, 0x0000, 0x0000},
+	{0xA66C, 0x0000, 0x0000}, {0xA680, 0x0000, 0x0000},
+	{0xA682, 0x0000, 0x0000}, {0xA684, 0x0000, 0x0000},
+	{0xA686, 0x0000, 0x0000}, {0xA688, 0x0000, 0x0000},
+	{0xA68A, 0x0000, 0x0000}, {0xA68C, 0x0000, 0x0000},
+	{0xA68E, 0x0000, 0x0000}, {0xA690, 0x0000, 0x0000},
+	{0xA692, 0x0000, 0x0000}, {0xA694, 0x0000, 0x0000},
+	{0xA696, 0x0000, 0x0000}, {0xA722, 0x0000, 0x0000},
+	{0xA724, 0x0000, 0x0000}, {0xA726, 0x0000, 0x0000},
+	{0xA728, 0x0000, 0x0000}, {0xA72A, 0x0000, 0x0000},
+	{0xA72C, 0x0000, 0x0000}, {0xA72E, 0x0000, 0x0000},
+	{0xA732, 0x0000, 0x0000}, {0xA734, 0x0000, 0x0000},
+	{0xA736, 0x0000, 0x0000}, {0xA738, 0x0000, 0x0000},
+	{0xA73A, 0x0000, 0x0000}, {0xA73C, 0x0000, 0x0000},
+	{0xA73E, 0x0000, 0x0000}, {0xA740, 0x0000, 0x0000},
+	{0xA742, 0x0000, 0x0000}, {0xA744, 0x0000, 0x0000},
+	{0xA746, 0x0000, 0x0000}, {0xA748, 0x0000, 0x0000},
+	{0xA74A, 0x0000, 0x0000}, {0xA74C, 0x0000, 0x0000},
+	{0xA74E, 0x0000, 0x0000}, {0xA750, 0x0000, 0x0000},
+	{0xA752, 0x0000, 0x0000}, {0xA754, 0x0000, 0x0000},
+	{0xA756, 0x0000, 0x0000}, {0xA758, 0x0000, 0x0000},
+	{0xA75A, 0x0000, 0x0000}, {0xA75C, 0x0000, 0x0000},
+	{0xA75E, 0x0000, 0x0000}, {0xA760, 0x0000, 0x0000},
+	{0xA762, 0x0000, 0x0000}, {0xA764, 0x0000, 0x0000},
+	{0xA766, 0x0000, 0x0000}, {0xA768, 0x0000, 0x0000},
+	{0xA76A, 0x0000, 0x0000}, {0xA76C, 0x0000, 0x0000},
+	{0xA76E, 0x0000, 0x0000}, {0xA779, 0x0000, 0x0000},
+	{0xA77B, 0x0000, 0x0000}, {0xA77E, 0x0000, 0x0000},
+	{0xA780, 0x0000, 0x0000}, {0xA782, 0x0000, 0x0000},
+	{0xA784, 0x0000, 0x0000}, {0xA786, 0x0000, 0x0000},
+	{0xA78B, 0x0000, 0x0000}, {0xA790, 0x0000, 0x0000},
+	{0xA792, 0x0000, 0x0000}, {0xA7A0, 0x0000, 0x0000},
+	{0xA7A2, 0x0000, 0x0000}, {0xA7A4, 0x0000, 0x0000},
+	{0xA7A6, 0x0000, 0x0000}, {0xA7A8, 0x0000, 0x0000},
+	{0x0046, 0x0046, 0x0000}, {0x0046, 0x0049, 0x0000},
+	{0x0046, 0x004C, 0x0000}, {0x0046, 0x0046, 0x0049},
+	{0x0046, 0x0046, 0x004C}, {0x0053, 0x0054, 0x0000},
+	{0x0544, 0x0546, 0x0000}, {0x0544, 0x0535, 0x0000},
+	{0x0544, 0x053B, 0x0000}, {0x054E, 0x0546, 0x0000},
+	{0x0544, 0x053D, 0x0000}, {0xFF21, 0x0000, 0x0000},
+	{0xFF22, 0x0000, 0x0000}, {0xFF23, 0x0000, 0x0000},
+	{0xFF24, 0x0000, 0x0000}, {0xFF25, 0x0000, 0x0000},
+	{0xFF26, 0x0000, 0x0000}, {0xFF27, 0x0000, 0x0000},
+	{0xFF28, 0x0000, 0x0000}, {0xFF29, 0x0000, 0x0000},
+	{0xFF2A, 0x0000, 0x0000}, {0xFF2B, 0x0000, 0x0000},
+	{0xFF2C, 0x0000, 0x0000}, {0xFF2D, 0x0000, 0x0000},
+	{0xFF2E, 0x0000, 0x0000}, {0xFF2F, 0x0000, 0x0000},
+	{0xFF30, 0x0000, 0x0000}, {0xFF31, 0x0000, 0x0000},
+	{0xFF32, 0x0000, 0x0000}, {0xFF33, 0x0000, 0x0000},
+	{0xFF34, 0x0000, 0x0000}, {0xFF35, 0x0000, 0x0000},
+	{0xFF36, 0x0000, 0x0000}, {0xFF37, 0x0000, 0x0000},
+	{0xFF38, 0x0000, 0x0000}, {0xFF39, 0x0000, 0x0000},
+	{0xFF3A, 0x0000, 0x0000}, {0x10400, 0x0000, 0x0000},
+	{0x10401, 0x0000, 0x0000}, {0x10402, 0x0000, 0x0000},
+	{0x10403, 0x0000, 0x0000}, {0x10404, 0x0000, 0x0000},
+	{0x10405, 0x0000, 0x0000}, {0x10406, 0x0000, 0x0000},
+	{0x10407, 0x0000, 0x0000}, {0x10408, 0x0000, 0x0000},
+	{0x10409, 0x0000, 0x0000}, {0x1040A, 0x0000, 0x0000},
+	{0x1040B, 0x0000, 0x0000}, {0x1040C, 0x0000, 0x0000},
+	{0x1040D, 0x0000, 0x0000}, {0x1040E, 0x0000, 0x0000},
+	{0x1040F, 0x0000, 0x0000}, {0x10410, 0x0000, 0x0000},
+	{0x10411, 0x0000, 0x0000}, {0x10412, 0x0000, 0x0000},
+	{0x10413, 0x0000, 0x0000}, {0x10414, 0x0000, 0x0000},
+	{0x10415, 0x0000, 0x0000}, {0x10416, 0x0000, 0x0000},
+	{0x10417, 0x0000, 0x0000}, {0x10418, 0x0000, 0x0000},
+	{0x10419, 0x0000, 0x0000}, {0x1041A, 0x0000, 0x0000},
+	{0x1041B, 0x0000, 0x0000}, {0x1041C, 0x0000, 0x0000},
+	{0x1041D, 0x0000, 0x0000}, {0x1041E, 0x0000, 0x0000},
+	{0x1041F, 0x0000, 0x0000}, {0x10420, 0x0000, 0x0000},
+	{0x10421, 0x0000, 0x0000}, {0x10422, 0x0000, 0x0000},
+	{0x10423, 0x0000, 0x0000}, {0x10424, 0x0000, 0x0000},
+	{0x10425, 0x0000, 0x0000}, {0x10426, 0x0000, 0x0000},
+	{0x10427, 0x0000, 0x0000}, {0x0061, 0x0000, 0x0000},
+	{0x0062, 0x0000, 0x0000}, {0x0063, 0x0000, 0x0000},
+	{0x0064, 0x0000, 0x0000}, {0x0065, 0x0000, 0x0000},
+	{0x0066, 0x0000, 0x0000}, {0x0067, 0x0000, 0x0000},
+	{0x0068, 0x0000, 0x0000}, {0x0069, 0x0000, 0x0000},
+	{0x006A, 0x0000, 0x0000}, {0x006B, 0x0000, 0x0000},
+	{0x006C, 0x0000, 0x0000}, {0x006D, 0x0000, 0x0000},
+	{0x006E, 0x0000, 0x0000}, {0x006F, 0x0000, 0x0000},
+	{0x0070, 0x0000, 0x0000}, {0x0071, 0x0000, 0x0000},
+	{0x0072, 0x0000, 0x0000}, {0x0073, 0x0000, 0x0000},
+	{0x0074, 0x0000, 0x0000}, {0x0075, 0x0000, 0x0000},
+	{0x0076, 0x0000, 0x0000}, {0x0077, 0x0000, 0x0000},
+	{0x0078, 0x0000, 0x0000}, {0x0079, 0x0000, 0x0000},
+	{0x007A, 0x0000, 0x0000}, {0x00E0, 0x0000, 0x0000},
+	{0x00E1, 0x0000, 0x0000}, {0x00E2, 0x0000, 0x0000},
+	{0x00E3, 0x0000, 0x0000}, {0x00E4, 0x0000, 0x0000},
+	{0x00E5, 0x0000, 0x0000}, {0x00E6, 0x0000, 0x0000},
+	{0x00E7, 0x0000, 0x0000}, {0x00E8, 0x0000, 0x0000},
+	{0x00E9, 0x0000, 0x0000}, {0x00EA, 0x0000, 0x0000},
+	{0x00EB, 0x0000, 0x0000}, {0x00EC, 0x0000, 0x0000},
+	{0x00ED, 0x0000, 0x0000}, {0x00EE, 0x0000, 0x0000},
+	{0x00EF, 0x0000, 0x0000}, {0x00F0, 0x0000, 0x0000},
+	{0x00F1, 0x0000, 0x0000}, {0x00F2, 0x0000, 0x0000},
+	{0x00F3, 0x0000, 0x0000}, {0x00F4, 0x0000, 0x0000},
+	{0x00F5, 0x0000, 0x0000}, {0x00F6, 0x0000, 0x0000},
+	{0x00F8, 0x0000, 0x0000}, {0x00F9, 0x0000, 0x0000},
+	{0x00FA, 0x0000, 0x0000}, {0x00FB, 0x0000, 0x0000},
+	{0x00FC, 0x0000, 0x0000}, {0x00FD, 0x0000, 0x0000},
+	{0x00FE, 0x0000, 0x0000}, {0x0101, 0x0000, 0x0000},
+	{0x0103, 0x0000, 0x0000}, {0x0105, 0x0000, 0x0000},
+	{0x0107, 0x0000, 0x0000}, {0x0109, 0x0000, 0x0000},
+	{0x010B, 0x0000, 0x0000}, {0x010D, 0x0000, 0x0000},
+	{0x010F, 0x0000, 0x0000}, {0x0111, 0x0000, 0x0000},
+	{0x0113, 0x0000, 0x0000}, {0x0115, 0x0000, 0x0000},
+	{0x0117, 0x0000, 0x0000}, {0x0119, 0x0000, 0x0000},
+	{0x011B, 0x0000, 0x0000}, {0x011D, 0x0000, 0x0000},
+	{0x011F, 0x0000, 0x0000}, {0x0121, 0x0000, 0x0000},
+	{0x0123, 0x0000, 0x0000}, {0x0125, 0x0000, 0x0000},
+	{0x0127, 0x0000, 0x0000}, {0x0129, 0x0000, 0x0000},
+	{0x012B, 0x0000, 0x0000}, {0x012D, 0x0000, 0x0000},
+	{0x012F, 0x0000, 0x0000}, {0x0069, 0x0307, 0x0000},
+	{0x0133, 0x0000, 0x0000}, {0x0135, 0x0000, 0x0000},
+	{0x0137, 0x0000, 0x0000}, {0x013A, 0x0000, 0x0000},
+	{0x013C, 0x0000, 0x0000}, {0x013E, 0x0000, 0x0000},
+	{0x0140, 0x0000, 0x0000}, {0x0142, 0x0000, 0x0000},
+	{0x0144, 0x0000, 0x0000}, {0x0146, 0x0000, 0x0000},
+	{0x0148, 0x0000, 0x0000}, {0x014B, 0x0000, 0x0000},
+	{0x014D, 0x0000, 0x0000}, {0x014F, 0x0000, 0x0000},
+	{0x0151, 0x0000, 0x0000}, {0x0153, 0x0000, 0x0000},
+	{0x0155, 0x0000, 0x0000}, {0x0157, 0x0000, 0x0000},
+	{0x0159, 0x0000, 0x0000}, {0x015B, 0x0000, 0x0000},
+	{0x015D, 0x0000, 0x0000}, {0x015F, 0x0000, 0x0000},
+	{0x0161, 0x0000, 0x0000}, {0x0163, 0x0000, 0x0000},
+	{0x0165, 0x0000, 0x0000}, {0x0167, 0x0000, 0x0000},
+	{0x0169, 0x0000, 0x0000}, {0x016B, 0x0000, 0x0000},
+	{0x016D, 0x0000, 0x0000}, {0x016F, 0x0000, 0x0000},
+	{0x0171, 0x0000, 0x0000}, {0x0173, 0x0000, 0x0000},
+	{0x0175, 0x0000, 0x0000}, {0x0177, 0x0000, 0x0000},
+	{0x00FF, 0x0000, 0x0000}, {0x017A, 0x0000, 0x0000},
+	{0x017C, 0x0000, 0x0000}, {0x017E, 0x0000, 0x0000},
+	{0x0253, 0x0000, 0x0000}, {0x0183, 0x0000, 0x0000},
+	{0x0185, 0x0000, 0x0000}, {0x0254, 0x0000, 0x0000},
+	{0x0188, 0x0000, 0x0000}, {0x0256, 0x0000, 0x0000},
+	{0x0257, 0x0000, 0x0000}, {0x018C, 0x0000, 0x0000},
+	{0x01DD, 0x0000, 0x0000}, {0x0259, 0x0000, 0x0000},
+	{0x025B, 0x0000, 0x0000}, {0x0192, 0x0000, 0x0000},
+	{0x0260, 0x0000, 0x0000}, {0x0263, 0x0000, 0x0000},
+	{0x0269, 0x0000, 0x0000}, {0x0268, 0x0000, 0x0000},
+	{0x0199, 0x0000, 0x0000}, {0x026F, 0x0000, 0x0000},
+	{0x0272, 0x0000, 0x0000}, {0x0275, 0x0000, 0x0000},
+	{0x01A1, 0x0000, 0x0000}, {0x01A3, 0x0000, 0x0000},
+	{0x01A5, 0x0000, 0x0000}, {0x0280, 0x0000, 0x0000},
+	{0x01A8, 0x0000, 0x0000}, {0x0283, 0x0000, 0x0000},
+	{0x01AD, 0x0000, 0x0000}, {0x0288, 0x0000, 0x0000},
+	{0x01B0, 0x0000, 0x0000}, {0x028A, 0x0000, 0x0000},
+	{0x028B, 0x0000, 0x0000}, {0x01B4, 0x0000, 0x0000},
+	{0x01B6, 0x0000, 0x0000}, {0x0292, 0x0000, 0x0000},
+	{0x01B9, 0x0000, 0x0000}, {0x01BD, 0x0000, 0x0000},
+	{0x01C6, 0x0000, 0x0000}, {0x01C9, 0x0000, 0x0000},
+	{0x01CC, 0x0000, 0x0000}, {0x01CE, 0x0000, 0x0000},
+	{0x01D0, 0x0000, 0x0000}, {0x01D2, 0x0000, 0x0000},
+	{0x01D4, 0x0000, 0x0000}, {0x01D6, 0x0000, 0x0000},
+	{0x01D8, 0x0000, 0x0000}, {0x01DA, 0x0000, 0x0000},
+	{0x01DC, 0x0000, 0x0000}, {0x01DF, 0x0000, 0x0000},
+	{0x01E1, 0x0000, 0x0000}, {0x01E3, 0x0000, 0x0000},
+	{0x01E5, 0x0000, 0x0000}, {0x01E7, 0x0000, 0x0000},
+	{0x01E9, 0x0000, 0x0000}, {0x01EB, 0x0000, 0x0000},
+	{0x01ED, 0x0000, 0x0000}, {0x01EF, 0x0000, 0x0000},
+	{0x01F3, 0x0000, 0x0000}, {0x01F5, 0x0000, 0x0000},
+	{0x0195, 0x0000, 0x0000}, {0x01BF, 0x0000, 0x0000},
+	{0x01F9, 0x0000, 0x0000}, {0x01FB, 0x0000, 0x0000},
+	{0x01FD, 0x0000, 0x0000}, {0x01FF, 0x0000, 0x0000},
+	{0x0201, 0x0000, 0x0000}, {0x0203, 0x0000, 0x0000},
+	{0x0205, 0x0000, 0x0000}, {0x0207, 0x0000, 0x0000},
+	{0x0209, 0x0000, 0x0000}, {0x020B, 0x0000, 0x0000},
+	{0x020D, 0x0000, 0x0000}, {0x020F, 0x0000, 0x0000},
+	{0x0211, 0x0000, 0x0000}, {0x0213, 0x0000, 0x0000},
+	{0x0215, 0x0000, 0x0000}, {0x0217, 0x0000, 0x0000},
+	{0x0219, 0x0000, 0x0000}, {0x021B, 0x0000, 0x0000},
+	{0x021D, 0x0000, 0x0000}, {0x021F, 0x0000, 0x0000},
+	{0x019E, 0x0000, 0x0000}, {0x0223, 0x0000, 0x0000},
+	{0x0225, 0x0000, 0x0000}, {0x0227, 0x0000, 0x0000},
+	{0x0229, 0x0000, 0x0000}, {0x022B, 0x0000, 0x0000},
+	{0x022D, 0x0000, 0x0000}, {0x022F, 0x0000, 0x0000},
+	{0x0231, 0x0000, 0x0000}, {0x0233, 0x0000, 0x0000},
+	{0x2C65, 0x0000, 0x0000}, {0x023C, 0x0000, 0x0000},
+	{0x019A, 0x0000, 0x0000}, {0x2C66, 0x0000, 0x0000},
+	{0x0242, 0x0000, 0x0000}, {0x0180, 0x0000, 0x0000},
+	{0x0289, 0x0000, 0x0000}, {0x028C, 0x0000, 0x0000},
+	{0x0247, 0x0000, 0x0000}, {0x0249, 0x0000, 0x0000},
+	{0x024B, 0x0000, 0x0000}, {0x024D, 0x0000, 0x0000},
+	{0x024F, 0x0000, 0x0000}, {0x0371, 0x0000, 0x0000},
+	{0x0373, 0x0000, 0x0000}, {0x0377, 0x0000, 0x0000},
+	{0x03AC, 0x0000, 0x0000}, {0x03AD, 0x0000, 0x0000},
+	{0x03AE, 0x0000, 0x0000}, {0x03AF, 0x0000, 0x0000},
+	{0x03CC, 0x0000, 0x0000}, {0x03CD, 0x0000, 0x0000},
+	{0x03CE, 0x0000, 0x0000}, {0x03B1, 0x0000, 0x0000},
+	{0x03B2, 0x0000, 0x0000}, {0x03B3, 0x0000, 0x0000},
+	{0x03B4, 0x0000, 0x0000}, {0x03B5, 0x0000, 0x0000},
+	{0x03B6, 0x0000, 0x0000}, {0x03B7, 0x0000, 0x0000},
+	{0x03B8, 0x0000, 0x0000}, {0x03B9, 0x0000, 0x0000},
+	{0x03BA, 0x0000, 0x0000}, {0x03BB, 0x0000, 0x0000},
+	{0x03BC, 0x0000, 0x0000}, {0x03BD, 0x0000, 0x0000},
+	{0x03BE, 0x0000, 0x0000}, {0x03BF, 0x0000, 0x0000},
+	{0x03C0, 0x0000, 0x0000}, {0x03C1, 0x0000, 0x0000},
+	{0x03C3, 0x0000, 0x0000}, {0x03C4, 0x0000, 0x0000},
+	{0x03C5, 0x0000, 0x0000}, {0x03C6, 0x0000, 0x0000},
+	{0x03C7, 0x0000, 0x0000}, {0x03C8, 0x0000, 0x0000},
+	{0x03C9, 0x0000, 0x0000}, {0x03CA, 0x0000, 0x0000},
+	{0x03CB, 0x0000, 0x0000}, {0x03D7, 0x0000, 0x0000},
+	{0x03D9, 0x0000, 0x0000}, {0x03DB, 0x0000, 0x0000},
+	{0x03DD, 0x0000, 0x0000}, {0x03DF, 0x0000, 0x0000},
+	{0x03E1, 0x0000, 0x0000}, {0x03E3, 0x0000, 0x0000},
+	{0x03E5, 0x0000, 0x0000}, {0x03E7, 0x0000, 0x0000},
+	{0x03E9, 0x0000, 0x0000}, {0x03EB, 0x0000, 0x0000},
+	{0x03ED, 0x0000, 0x0000}, {0x03EF, 0x0000, 0x0000},
+	{0x03F8, 0x0000, 0x0000}, {0x03F2, 0x0000, 0x0000},
+	{0x03FB, 0x0000, 0x0000}, {0x037B, 0x0000, 0x0000},
+	{0x037C, 0x0000, 0x0000}, {0x037D, 0x0000, 0x0000},
+	{0x0450, 0x0000, 0x0000}, {0x0451, 0x0000, 0x0000},
+	{0x0452, 0x0000, 0x0000}, {0x0453, 0x0000, 0x0000},
+	{0x0454, 0x0000, 0x0000}, {0x0455, 0x0000, 0x0000},
+	{0x0456, 0x0000, 0x0000}, {0x0457, 0x0000, 0x0000},
+	{0x0458, 0x0000, 0x0000}, {0x0459, 0x0000, 0x0000},
+	{0x045A, 0x0000, 0x0000}, {0x045B, 0x0000, 0x0000},
+	{0x045C, 0x0000, 0x0000}, {0x045D, 0x0000, 0x0000},
+	{0x045E, 0x0000, 0x0000}, {0x045F, 0x0000, 0x0000},
+	{0x0430, 0x0000, 0x0000}, {0x0431, 0x0000, 0x0000},
+	{0x0432, 0x0000, 0x0000}, {0x0433, 0x0000, 0x0000},
+	{0x0434, 0x0000, 0x0000}, {0x0435, 0x0000, 0x0000},
+	{0x0436, 0x0000, 0x0000}, {0x0437, 0x0000, 0x0000},
+	{0x0438, 0x0000, 0x0000}, {0x0439, 0x0000, 0x0000},
+	{0x043A, 0x0000, 0x0000}, {0x043B, 0x0000, 0x0000},
+	{0x043C, 0x0000, 0x0000}, {0x043D, 0x0000, 0x0000},
+	{0x043E, 0x0000, 0x0000}, {0x043F, 0x0000, 0x0000},
+	{0x0440, 0x0000, 0x0000}, {0x0441, 0x0000, 0x0000},
+	{0x0442, 0x0000, 0x0000}, {0x0443, 0x0000, 0x0000},
+	{0x0444, 0x0000, 0x0000}, {0x0445, 0x0000, 0x0000},
+	{0x0446, 0x0000, 0x0000}, {0x0447, 0x0000, 0x0000},
+	{0x0448, 0x0000, 0x0000}, {0x0449, 0x0000, 0x0000},
+	{0x044A, 0x0000, 0x0000}, {0x044B, 0x0000, 0x0000},
+	{0x044C, 0x0000, 0x0000}, {0x044D, 0x0000, 0x0000},
+	{0x044E, 0x0000, 0x0000}, {0x044F, 0x0000, 0x0000},
+	{0x0461, 0x0000, 0x0000}, {0x0463, 0x0000, 0x0000},
+	{0x0465, 0x0000, 0x0000}, {0x0467, 0x0000, 0x0000},
+	{0x0469, 0x0000, 0x0000}, {0x046B, 0x0000, 0x0000},
+	{0x046D, 0x0000, 0x0000}, {0x046F, 0x0000, 0x0000},
+	{0x0471, 0x0000, 0x0000}, {0x0473, 0x0000, 0x0000},
+	{0x0475, 0x0000, 0x0000}, {0x0477, 0x0000, 0x0000},
+	{0x0479, 0x0000, 0x0000}, {0x047B, 0x0000, 0x0000},
+	{0x047D, 0x0000, 0x0000}, {0x047F, 0x0000, 0x0000},
+	{0x0481, 0x0000, 0x0000}, {0x048B, 0x0000, 0x0000},
+	{0x048D, 0x0000, 0x0000}, {0x048F, 0x0000, 0x0000},
+	{0x0491, 0x0000, 0x0000}, {0x0493, 0x0000, 0x0000},
+	{0x0495, 0x0000, 0x0000}, {0x0497, 0x0000, 0x0000},
+	{0x0499, 0x0000, 0x0000}, {0x049B, 0x0000, 0x0000},
+	{0x049D, 0x0000, 0x0000}, {0x049F, 0x0000, 0x0000},
+	{0x04A1, 0x0000, 0x0000}, {0x04A3, 0x0000, 0x0000},
+	{0x04A5, 0x0000, 0x0000}, {0x04A7, 0x0000, 0x0000},
+	{0x04A9, 0x0000, 0x0000}, {0x04AB, 0x0000, 0x0000},
+	{0x04AD, 0x0000, 0x0000}, {0x04AF, 0x0000, 0x0000},
+	{0x04B1, 0x0000, 0x0000}, {0x04B3, 0x0000, 0x0000},
+	{0x04B5, 0x0000, 0x0000}, {0x04B7, 0x0000, 0x0000},
+	{0x04B9, 0x0000, 0x0000}, {0x04BB, 0x0000, 0x0000},
+	{0x04BD, 0x0000, 0x0000}, {0x04BF, 0x0000, 0x0000},
+	{0x04CF, 0x0000, 0x0000}, {0x04C2, 0x0000, 0x0000},
+	{0x04C4, 0x0000, 0x0000}, {0x04C6, 0x0000, 0x0000},
+	{0x04C8, 0x0000, 0x0000}, {0x04CA, 0x0000, 0x0000},
+	{0x04CC, 0x0000, 0x0000}, {0x04CE, 0x0000, 0x0000},
+	{0x04D1, 0x0000, 0x0000}, {0x04D3, 0x0000, 0x0000},
+	{0x04D5, 0x0000, 0x0000}, {0x04D7, 0x0000, 0x0000},
+	{0x04D9, 0x0000, 0x0000}, {0x04DB, 0x0000, 0x0000},
+	{0x04DD, 0x0000, 0x0000}, {0x04DF, 0x0000, 0x0000},
+	{0x04E1, 0x0000, 0x0000}, {0x04E3, 0x0000, 0x0000},
+	{0x04E5, 0x0000, 0x0000}, {0x04E7, 0x0000, 0x0000},
+	{0x04E9, 0x0000, 0x0000}, {0x04EB, 0x0000, 0x0000},
+	{0x04ED, 0x0000, 0x0000}, {0x04EF, 0x0000, 0x0000},
+	{0x04F1, 0x0000, 0x0000}, {0x04F3, 0x0000, 0x0000},
+	{0x04F5, 0x0000, 0x0000}, {0x04F7, 0x0000, 0x0000},
+	{0x04F9, 0x0000, 0x0000}, {0x04FB, 0x0000, 0x0000},
+	{0x04FD, 0x0000, 0x0000}, {0x04FF, 0x0000, 0x0000},
+	{0x0501, 0x0000, 0x0000}, {0x0503, 0x0000, 0x0000},
+	{0x0505, 0x0000, 0x0000}, {0x0507, 0x0000, 0x0000},
+	{0x0509, 0x0000, 0x0000}, {0x050B, 0x0000, 0x0000},
+	{0x050D, 0x0000, 0x0000}, {0x050F, 0x0000, 0x0000},
+	{0x0511, 0x0000, 0x0000}, {0x0513, 0x0000, 0x0000},
+	{0x0515, 0x0000, 0x0000}, {0x0517, 0x0000, 0x0000},
+	{0x0519, 0x0000, 0x0000}, {0x051B, 0x0000, 0x0000},
+	{0x051D, 0x0000, 0x0000}, {0x051F, 0x0000, 0x0000},
+	{0x0521, 0x0000, 0x0000}, {0x0523, 0x0000, 0x0000},
+	{0x0525, 0x0000, 0x0000}, {0x0527, 0x0000, 0x0000},
+	{0x0561, 0x0000, 0x0000}, {0x0562, 0x0000, 0x0000},
+	{0x0563, 0x0000, 0x0000}, {0x0564, 0x0000, 0x0000},
+	{0x0565, 0x0000, 0x0000}, {0x0566, 0x0000, 0x0000},
+	{0x0567, 0x0000, 0x0000}, {0x0568, 0x0000, 0x0000},
+	{0x0569, 0x0000, 0x0000}, {0x056A, 0x0000, 0x0000},
+	{0x056B, 0x0000, 0x0000}, {0x056C, 0x0000, 0x0000},
+	{0x056D, 0x0000, 0x0000}, {0x056E, 0x0000, 0x0000},
+	{0x056F, 0x0000, 0x0000}, {0x0570, 0x0000, 0x0000},
+	{0x0571, 0x0000, 0x0000}, {0x0572, 0x0000, 0x0000},
+	{0x0573, 0x0000, 0x0000}, {0x0574, 0x0000, 0x0000},
+	{0x0575, 0x0000, 0x0000}, {0x0576, 0x0000, 0x0000},
+	{0x0577, 0x0000, 0x0000}, {0x0578, 0x0000, 0x0000},
+	{0x0579, 0x0000, 0x0000}, {0x057A, 0x0000, 0x0000},
+	{0x057B, 0x0000, 0x0000}, {0x057C, 0x0000, 0x0000},
+	{0x057D, 0x0000, 0x0000}, {0x057E, 0x0000, 0x0000},
+	{0x057F, 0x0000, 0x0000}, {0x0580, 0x0000, 0x0000},
+	{0x0581, 0x0000, 0x0000}, {0x0582, 0x0000, 0x0000},
+	{0x0583, 0x0000, 0x0000}, {0x0584, 0x0000, 0x0000},
+	{0x0585, 0x0000, 0x0000}, {0x0586, 0x0000, 0x0000},
+	{0x2D00, 0x0000, 0x0000}, {0x2D01, 0x0000, 0x0000},
+	{0x2D02, 0x0000, 0x0000}, {0x2D03, 0x0000, 0x0000},
+	{0x2D04, 0x0000, 0x0000}, {0x2D05, 0x0000, 0x0000},
+	{0x2D06, 0x0000, 0x0000}, {0x2D07, 0x0000, 0x0000},
+	{0x2D08, 0x0000, 0x0000}, {0x2D09, 0x0000, 0x0000},
+	{0x2D0A, 0x0000, 0x0000}, {0x2D0B, 0x0000, 0x0000},
+	{0x2D0C, 0x0000, 0x0000}, {0x2D0D, 0x0000, 0x0000},
+	{0x2D0E, 0x0000, 0x0000}, {0x2D0F, 0x0000, 0x0000},
+	{0x2D10, 0x0000, 0x0000}, {0x2D11, 0x0000, 0x0000},
+	{0x2D12, 0x0000, 0x0000}, {0x2D13, 0x0000, 0x0000},
+	{0x2D14, 0x0000, 0x0000}, {0x2D15, 0x0000, 0x0000},
+	{0x2D16, 0x0000, 0x0000}, {0x2D17, 0x0000, 0x0000},
+	{0x2D18, 0x0000, 0x0000}, {0x2D19, 0x0000, 0x0000},
+	{0x2D1A, 0x0000, 0x0000}, {0x2D1B, 0x0000, 0x0000},
+	{0x2D1C, 0x0000, 0x0000}, {0x2D1D, 0x0000, 0x0000},
+	{0x2D1E, 0x0000, 0x0000}, {0x2D1F, 0x0000, 0x0000},
+	{0x2D20, 0x0000, 0x0000}, {0x2D21, 0x0000, 0x0000},
+	{0x2D22, 0x0000, 0x0000}, {0x2D23, 0x0000, 0x0000},
+	{0x2D24, 0x0000, 0x0000}, {0x2D25, 0x0000, 0x0000},
+	{0x2D27, 0x0000, 0x0000}, {0x2D2D, 0x0000, 0x0000},
+	{0x1E01, 0x0000, 0x0000}, {0x1E03, 0x0000, 0x0000},
+	{0x1E05, 0x0000, 0x0000}, {0x1E07, 0x0000, 0x0000},
+	{0x1E09, 0x0000, 0x0000}, {0x1E0B, 0x0000, 0x0000},
+	{0x1E0D, 0x0000, 0x0000}, {0x1E0F, 0x0000, 0x0000},
+	{0x1E11, 0x0000, 0x0000}, {0x1E13, 0x0000, 0x0000},
+	{0x1E15, 0x0000, 0x0000}, {0x1E17, 0x0000, 0x0000},
+	{0x1E19, 0x0000, 0x0000}, {0x1E1B, 0x0000, 0x0000},
+	{0x1E1D, 0x0000, 0x0000}, {0x1E1F, 0x0000, 0x0000},
+	{0x1E21, 0x0000, 0x0000}, {0x1E23, 0x0000, 0x0000},
+	{0x1E25, 0x0000, 0x0000}, {0x1E27, 0x0000, 0x0000},
+	{0x1E29, 0x0000, 0x0000}, {0x1E2B, 0x0000, 0x0000},
+	{0x1E2D, 0x0000, 0x0000}, {0x1E2F, 0x0000, 0x0000},
+	{0x1E31, 0x0000, 0x0000}, {0x1E33, 0x0000, 0x0000},
+	{0x1E35, 0x0000, 0x0000}, {0x1E37, 0x0000, 0x0000},
+	{0x1E39, 0x0000, 0x0000}, {0x1E3B, 0x0000, 0x0000},
+	{0x1E3D, 0x0000, 0x0000}, {0x1E3F, 0x0000, 0x0000},
+	{0x1E41, 0x0000, 0x0000}, {0x1E43, 0x0000, 0x0000},
+	{0x1E45, 0x0000, 0x0000}, {0x1E47, 0x0000, 0x0000},
+	{0x1E49, 0x0000, 0x0000}, {0x1E4B, 0x0000, 0x0000},
+	{0x1E4D, 0x0000, 0x0000}, {0x1E4F, 0x0000, 0x0000},
+	{0x1E51, 0x0000, 0x0000}, {0x1E53, 0x0000, 0x0000},
+	{0x1E55, 0x0000, 0x0000}, {0x1E57, 0x0000, 0x0000},
+	{0x1E59, 0x0000, 0x0000}, {0x1E5B, 0x0000, 0x0000},
+	{0x1E5D, 0x0000, 0x0000}, {0x1E5F, 0x0000, 0x0000},
+	{0x1E61, 0x0000, 0x0000}, {0x1E63, 0x0000, 0x0000},
+	{0x1E65, 0x0000, 0x0000}, {0x1E67, 0x0000, 0x0000},
+	{0x1E69, 0x0000, 0x0000}, {0x1E6B, 0x0000, 0x0000},
+	{0x1E6D, 0x0000, 0x0000}, {0x1E6F, 0x0000, 0x0000},
+	{0x1E71, 0x0000, 0x0000}, {0x1E73, 0x0000, 0x0000},
+	{0x1E75, 0x0000, 0x0000}, {0x1E77, 0x0000, 0x0000},
+	{0x1E79, 0x0000, 0x0000}, {0x1E7B, 0x0000, 0x0000},
+	{0x1E7D, 0x0000, 0x0000}, {0x1E7F, 0x0000, 0x0000},
+	{0x1E81, 0x0000, 0x0000}, {0x1E83, 0x0000, 0x0000},
+	{0x1E85, 0x0000, 0x0000}, {0x1E87, 0x0000, 0x0000},
+	{0x1E89, 0x0000, 0x0000}, {0x1E8B, 0x0000, 0x0000},
+	{0x1E8D, 0x0000, 0x0000}, {0x1E8F, 0x0000, 0x0000},
+	{0x1E91, 0x0000, 0x0000}, {0x1E93, 0x0000, 0x0000},
+	{0x1E95, 0x0000, 0x0000}, {0x00DF, 0x0000, 0x0000},
+	{0x1EA1, 0x0000, 0x0000}, {0x1EA3, 0x0000, 0x0000},
+	{0x1EA5, 0x0000, 0x0000}, {0x1EA7, 0x0000, 0x0000},
+	{0x1EA9, 0x0000, 0x0000}, {0x1EAB, 0x0000, 0x0000},
+	{0x1EAD, 0x0000, 0x0000}, {0x1EAF, 0x0000, 0x0000},
+	{0x1EB1, 0x0000, 0x0000}, {0x1EB3, 0x0000, 0x0000},
+	{0x1EB5, 0x0000, 0x0000}, {0x1EB7, 0x0000, 0x0000},
+	{0x1EB9, 0x0000, 0x0000}, {0x1EBB, 0x0000, 0x0000},
+	{0x1EBD, 0x0000, 0x0000}, {0x1EBF, 0x0000, 0x0000},
+	{0x1EC1, 0x0000, 0x0000}, {0x1EC3, 0x0000, 0x0000},
+	{0x1EC5, 0x0000, 0x0000}, {0x1EC7, 0x0000, 0x0000},
+	{0x1EC9, 0x0000, 0x0000}, {0x1ECB, 0x0000, 0x0000},
+	{0x1ECD, 0x0000, 0x0000}, {0x1ECF, 0x0000, 0x0000},
+	{0x1ED1, 0x0000, 0x0000}, {0x1ED3, 0x0000, 0x0000},
+	{0x1ED5, 0x0000, 0x0000}, {0x1ED7, 0x0000, 0x0000},
+	{0x1ED9, 0x0000, 0x0000}, {0x1EDB, 0x0000, 0x0000},
+	{0x1EDD, 0x0000, 0x0000}, {0x1EDF, 0x0000, 0x0000},
+	{0x1EE1, 0x0000, 0x0000}, {0x1EE3, 0x0000, 0x0000},
+	{0x1EE5, 0x0000, 0x0000}, {0x1EE7, 0x0000, 0x0000},
+	{0x1EE9, 0x0000, 0x0000}, {0x1EEB, 0x0000, 0x0000},
+	{0x1EED, 0x0000, 0x0000}, {0x1EEF, 0x0000, 0x0000},
+	{0x1EF1, 0x0000, 0x0000}, {0x1EF3, 0x0000, 0x0000},
+	{0x1EF5, 0x0000, 0x0000}, {0x1EF7, 0x0000, 0x0000},
+	{0x1EF9, 0x0000, 0x0000}, {0x1EFB, 0x0000, 0x0000},
+	{0x1EFD, 0x0000, 0x0000}, {0x1EFF, 0x0000, 0x0000},
+	{0x1F00, 0x0000, 0x0000}, {0x1F01, 0x0000, 0x0000},
+	{0x1F02, 0x0000, 0x0000}, {0x1F03, 0x0000, 0x0000},
+	{0x1F04, 0x0000, 0x0000}, {0x1F05, 0x0000, 0x0000},
+	{0x1F06, 0x0000, 0x0000}, {0x1F07, 0x0000, 0x0000},
+	{0x1F10, 0x0000, 0x0000}, {0x1F11, 0x0000, 0x0000},
+	{0x1F12, 0x0000, 0x0000}, {0x1F13, 0x0000, 0x0000},
+	{0x1F14, 0x0000, 0x0000}, {0x1F15, 0x0000, 0x0000},
+	{0x1F20, 0x0000, 0x0000}, {0x1F21, 0x0000, 0x0000},
+	{0x1F22, 0x0000, 0x0000}, {0x1F23, 0x0000, 0x0000},
+	{0x1F24, 0x0000, 0x0000}, {0x1F25, 0x0000, 0x0000},
+	{0x1F26, 0x0000, 0x0000}, {0x1F27, 0x0000, 0x0000},
+	{0x1F30, 0x0000, 0x0000}, {0x1F31, 0x0000, 0x0000},
+	{0x1F32, 0x0000, 0x0000}, {0x1F33, 0x0000, 0x0000},
+	{0x1F34, 0x0000, 0x0000}, {0x1F35, 0x0000, 0x0000},
+	{0x1F36, 0x0000, 0x0000}, {0x1F37, 0x0000, 0x0000},
+	{0x1F40, 0x0000, 0x0000}, {0x1F41, 0x0000, 0x0000},
+	{0x1F42, 0x0000, 0x0000}, {0x1F43, 0x0000, 0x0000},
+	{0x1F44, 0x0000, 0x0000}, {0x1F45, 0x0000, 0x0000},
+	{0x1F51, 0x0000, 0x0000}, {0x1F53, 0x0000, 0x0000},
+	{0x1F55, 0x0000, 0x0000}, {0x1F57, 0x0000, 0x0000},
+	{0x1F60, 0x0000, 0x0000}, {0x1F61, 0x0000, 0x0000},
+	{0x1F62, 0x0000, 0x0000}, {0x1F63, 0x0000, 0x0000},
+	{0x1F64, 0x0000, 0x0000}, {0x1F65, 0x0000, 0x0000},
+	{0x1F66, 0x0000, 0x0000}, {0x1F67, 0x0000, 0x0000},
+	{0x1F80, 0x0000, 0x0000}, {0x1F81, 0x0000, 0x0000},
+	{0x1F82, 0x0000, 0x0000}, {0x1F83, 0x0000, 0x0000},
+	{0x1F84, 0x0000, 0x0000}, {0x1F85, 0x0000, 0x0000},
+	{0x1F86, 0x0000, 0x0000}, {0x1F87, 0x0000, 0x0000},
+	{0x1F90, 0x0000, 0x0000}, {0x1F91, 0x0000, 0x0000},
+	{0x1F92, 0x0000, 0x0000}, {0x1F93, 0x0000, 0x0000},
+	{0x1F94, 0x0000, 0x0000}, {0x1F95, 0x0000, 0x0000},
+	{0x1F96, 0x0000, 0x0000}, {0x1F97, 0x0000, 0x0000},
+	{0x1FA0, 0x0000, 0x0000}, {0x1FA1, 0x0000, 0x0000},
+	{0x1FA2, 0x0000, 0x0000}, {0x1FA3, 0x0000, 0x0000},
+	{0x1FA4, 0x0000, 0x0000}, {0x1FA5, 0x0000, 0x0000},
+	{0x1FA6, 0x0000, 0x0000}, {0x1FA7, 0x0000, 0x0000},
+	{0x1FB0, 0x0000, 0x0000}, {0x1FB1, 0x0000, 0x0000},
+	{0x1F70, 0x0000, 0x0000}, {0x1F71, 0x0000, 0x0000},
+	{0x1FB3, 0x0000, 0x0000}, {0x1F72, 0x0000, 0x0000},
+	{0x1F73, 0x0000, 0x0000}, {0x1F74, 0x0000, 0x0000},
+	{0x1F75, 0x0000, 0x0000}, {0x1FC3, 0x0000, 0x0000},
+	{0x1FD0, 0x0000, 0x0000}, {0x1FD1, 0x0000, 0x0000},
+	{0x1F76, 0x0000, 0x0000}, {0x1F77, 0x0000, 0x0000},
+	{0x1FE0, 0x0000, 0x0000}, {0x1FE1, 0x0000, 0x0000},
+	{0x1F7A, 0x0000, 0x0000}, {0x1F7B, 0x0000, 0x0000},
+	{0x1FE5, 0x0000, 0x0000}, {0x1F78, 0x0000, 0x0000},
+	{0x1F79, 0x0000, 0x0000}, {0x1F7C, 0x0000, 0x0000},
+	{0x1F7D, 0x0000, 0x0000}, {0x1FF3, 0x0000, 0x0000},
+	{0x214E, 0x0000, 0x0000}, {0x2170, 0x0000, 0x0000},
+	{0x2171, 0x0000, 0x0000}, {0x2172, 0x0000, 0x0000},
+	{0x2173, 0x0000, 0x0000}, {0x2174, 0x0000, 0x0000},
+	{0x2175, 0x0000, 0x0000}, {0x2176, 0x0000, 0x0000},
+	{0x2177, 0x0000, 0x0000}, {0x2178, 0x0000, 0x0000},
+	{0x2179, 0x0000, 0x0000}, {0x217A, 0x0000, 0x0000},
+	{0x217B, 0x0000, 0x0000}, {0x217C, 0x0000, 0x0000},
+	{0x217D, 0x0000, 0x0000}, {0x217E, 0x0000, 0x0000},
+	{0x217F, 0x0000, 0x0000}, {0x2184, 0x0000, 0x0000},
+	{0x24D0, 0x0000, 0x0000}, {0x24D1, 0x0000, 0x0000},
+	{0x24D2, 0x0000, 0x0000}, {0x24D3, 0x0000, 0x0000},
+	{0x24D4, 0x0000, 0x0000}, {0x24D5, 0x0000, 0x0000},
+	{0x24D6, 0x0000, 0x0000}, {0x24D7, 0x0000, 0x0000},
+	{0x24D8, 0x0000, 0x0000}, {0x24D9, 0x0000, 0x0000},
+	{0x24DA, 0x0000, 0x0000}, {0x24DB, 0x0000, 0x0000},
+	{0x24DC, 0x0000, 0x0000}, {0x24DD, 0x0000, 0x0000},
+	{0x24DE, 0x0000, 0x0000}, {0x24DF, 0x0000, 0x0000},
+	{0x24E0, 0x0000, 0x0000}, {0x24E1, 0x0000, 0x0000},
+	{0x24E2, 0x0000, 0x0000}, {0x24E3, 0x0000, 0x0000},
+	{0x24E4, 0x0000, 0x0000}, {0x24E5, 0x0000, 0x0000},
+	{0x24E6, 0x0000, 0x0000}, {0x24E7, 0x0000, 0x0000},
+	{0x24E8, 0x0000, 0x0000}, {0x24E9, 0x0000, 0x0000},
+	{0x2C30, 0x0000, 0x0000}, {0x2C31, 0x0000, 0x0000},
+	{0x2C32, 0x0000, 0x0000}, {0x2C33, 0x0000, 0x0000},
+	{0x2C34, 0x0000, 0x0000}, {0x2C35, 0x0000, 0x0000},
+	{0x2C36, 0x0000, 0x0000}, {0x2C37, 0x0000, 0x0000},
+	{0x2C38, 0x0000, 0x0000}, {0x2C39, 0x0000, 0x0000},
+	{0x2C3A, 0x0000, 0x0000}, {0x2C3B, 0x0000, 0x0000},
+	{0x2C3C, 0x0000, 0x0000}, {0x2C3D, 0x0000, 0x0000},
+	{0x2C3E, 0x0000, 0x0000}, {0x2C3F, 0x0000, 0x0000},
+	{0x2C40, 0x0000, 0x0000}, {0x2C41, 0x0000, 0x0000},
+	{0x2C42, 0x0000, 0x0000}, {0x2C43, 0x0000, 0x0000},
+	{0x2C44, 0x0000, 0x0000}, {0x2C45, 0x0000, 0x0000},
+	{0x2C46, 0x0000, 0x0000}, {0x2C47, 0x0000, 0x0000},
+	{0x2C48, 0x0000, 0x0000}, {0x2C49, 0x0000, 0x0000},
+	{0x2C4A, 0x0000, 0x0000}, {0x2C4B, 0x0000, 0x0000},
+	{0x2C4C, 0x0000, 0x0000}, {0x2C4D, 0x0000, 0x0000},
+	{0x2C4E, 0x0000, 0x0000}, {0x2C4F, 0x0000, 0x0000},
+	{0x2C50, 0x0000, 0x0000}, {0x2C51, 0x0000, 0x0000},
+	{0x2C52, 0x0000, 0x0000}, {0x2C53, 0x0000, 0x0000},
+	{0x2C54, 0x0000, 0x0000}, {0x2C55, 0x0000, 0x0000},
+	{0x2C56, 0x0000, 0x0000}, {0x2C57, 0x0000, 0x0000},
+	{0x2C58, 0x0000, 0x0000}, {0x2C59, 0x0000, 0x0000},
+	{0x2C5A, 0x0000, 0x0000}, {0x2C5B, 0x0000, 0x0000},
+	{0x2C5C, 0x0000, 0x0000}, {0x2C5D, 0x0000, 0x0000},
+	{0x2C5E, 0x0000, 0x0000}, {0x2C61, 0x0000, 0x0000},
+	{0x026B, 0x0000, 0x0000}, {0x1D7D, 0x0000, 0x0000},
+	{0x027D, 0x0000, 0x0000}, {0x2C68, 0x0000, 0x0000},
+	{0x2C6A, 0x0000, 0x0000}, {0x2C6C, 0x0000, 0x0000},
+	{0x0251, 0x0000, 0x0000}, {0x0271, 0x0000, 0x0000},
+	{0x0250, 0x0000, 0x0000}, {0x0252, 0x0000, 0x0000},
+	{0x2C73, 0x0000, 0x0000}, {0x2C76, 0x0000, 0x0000},
+	{0x023F, 0x0000, 0x0000}, {0x0240, 0x0000, 0x0000},
+	{0x2C81, 0x0000, 0x0000}, {0x2C83, 0x0000, 0x0000},
+	{0x2C85, 0x0000, 0x0000}, {0x2C87, 0x0000, 0x0000},
+	{0x2C89, 0x0000, 0x0000}, {0x2C8B, 0x0000, 0x0000},
+	{0x2C8D, 0x0000, 0x0000}, {0x2C8F, 0x0000, 0x0000},
+	{0x2C91, 0x0000, 0x0000}, {0x2C93, 0x0000, 0x0000},
+	{0x2C95, 0x0000, 0x0000}, {0x2C97, 0x0000, 0x0000},
+	{0x2C99, 0x0000, 0x0000}, {0x2C9B, 0x0000, 0x0000},
+	{0x2C9D, 0x0000, 0x0000}, {0x2C9F, 0x0000, 0x0000},
+	{0x2CA1, 0x0000, 0x0000}, {0x2CA3, 0x0000, 0x0000},
+	{0x2CA5, 0x0000, 0x0000}, {0x2CA7, 0x0000, 0x0000},
+	{0x2CA9, 0x0000, 0x0000}, {0x2CAB, 0x0000, 0x0000},
+	{0x2CAD, 0x0000, 0x0000}, {0x2CAF, 0x0000, 0x0000},
+	{0x2CB1, 0x0000, 0x0000}, {0x2CB3, 0x0000, 0x0000},
+	{0x2CB5, 0x0000, 0x0000}, {0x2CB7, 0x0000, 0x0000},
+	{0x2CB9, 0x0000, 0x0000}, {0x2CBB, 0x0000, 0x0000},
+	{0x2CBD, 0x0000, 0x0000}, {0x2CBF, 0x0000, 0x0000},
+	{0x2CC1, 0x0000, 0x0000}, {0x2CC3, 0x0000, 0x0000},
+	{0x2CC5, 0x0000, 0x0000}, {0x2CC7, 0x0000, 0x0000},
+	{0x2CC9, 0x0000, 0x0000}, {0x2CCB, 0x0000, 0x0000},
+	{0x2CCD, 0x0000, 0x0000}, {0x2CCF, 0x0000, 0x0000},
+	{0x2CD1, 0x0000, 0x0000}, {0x2CD3, 0x0000, 0x0000},
+	{0x2CD5, 0x0000, 0x0000}, {0x2CD7, 0x0000, 0x0000},
+	{0x2CD9, 0x0000, 0x0000}, {0x2CDB, 0x0000, 0x0000},
+	{0x2CDD, 0x0000, 0x0000}, {0x2CDF, 0x0000, 0x0000},
+	{0x2CE1, 0x0000, 0x0000}, {0x2CE3, 0x0000, 0x0000},
+	{0x2CEC, 0x0000, 0x0000}, {0x2CEE, 0x0000, 0x0000},
+	{0x2CF3, 0x0000, 0x0000}, {0xA641, 0x0000, 0x0000},
+	{0xA643, 0x0000, 0x0000}, {0xA645, 0x0000, 0x0000},
+	{0xA647, 0x0000, 0x0000}, {0xA649, 0x0000, 0x0000},
+	{0xA64B, 0x0000, 0x0000}, {0xA64D, 0x0000, 0x0000},
+	{0xA64F, 0x0000, 0x0000}, {0xA651, 0x0000, 0x0000},
+	{0xA653, 0x0000, 0x0000}, {0xA655, 0x0000, 0x0000},
+	{0xA657, 0x0000, 0x0000}, {0xA659, 0x0000, 0x0000},
+	{0xA65B, 0x0000, 0x0000}, {0xA65D, 0x0000, 0x0000},
+	{0xA65F, 0x0000, 0x0000}, {0xA661, 0x0000, 0x0000},
+	{0xA663, 0x0000, 0x0000}, {0xA665, 0x0000, 0x0000},
+	{0xA667, 0x0000, 0x0000}, {0xA669, 0x0000, 0x0000},
+	{0xA66B, 0x0000, 0x0000}, {0xA66D, 0x0000, 0x0000},
+	{0xA681, 0x0000, 0x0000}, {0xA683, 0x0000, 0x0000},
+	{0xA685, 0x0000, 0x0000}, {0xA687, 0x0000, 0x0000},
+	{0xA689, 0x0000, 0x0000}, {0xA68B, 0x0000, 0x0000},
+	{0xA68D, 0x0000, 0x0000}, {0xA68F, 0x0000, 0x0000},
+	{0xA691, 0x0000, 0x0000}, {0xA693, 0x0000, 0x0000},
+	{0xA695, 0x0000, 0x0000}, {0xA697, 0x0000, 0x0000},
+	{0xA723, 0x0000, 0x0000}, {0xA725, 0x0000, 0x0000},
+	{0xA727, 0x0000, 0x0000}, {0xA729, 0x0000, 0x0000},
+	{0xA72B, 0x0000, 0x0000}, {0xA72D, 0x0000, 0x0000},
+	{0xA72F, 0x0000, 0x0000}, {0xA733, 0x0000, 0x0000},
+	{0xA735, 0x0000, 0x0000}, {0xA737, 0x0000, 0x0000},
+	{0xA739, 0x0000, 0x0000}, {0xA73B, 0x0000, 0x0000},
+	{0xA73D, 0x0000, 0x0000}, {0xA73F, 0x0000, 0x0000},
+	{0xA741, 0x0000, 0x0000}, {0xA743, 0x0000, 0x0000},
+	{0xA745, 0x0000, 0x0000}, {0xA747, 0x0000, 0x0000},
+	{0xA749, 0x0000, 0x0000}, {0xA74B, 0x0000, 0x0000},
+	{0xA74D, 0x0000, 0x0000}, {0xA74F, 0x0000, 0x0000},
+	{0xA751, 0x0000, 0x0000}, {0xA753, 0x0000, 0x0000},
+	{0xA755, 0x0000, 0x0000}, {0xA757, 0x0000, 0x0000},
+	{0xA759, 0x0000, 0x0000}, {0xA75B, 0x0000, 0x0000},
+	{0xA75D, 0x0000, 0x0000}, {0xA75F, 0x0000, 0x0000},
+	{0xA761, 0x0000, 0x0000}, {0xA763, 0x0000, 0x0000},
+	{0xA765, 0x0000, 0x0000}, {0xA767, 0x0000, 0x0000},
+	{0xA769, 0x0000, 0x0000}, {0xA76B, 0x0000, 0x0000},
+	{0xA76D, 0x0000, 0x0000}, {0xA76F, 0x0000, 0x0000},
+	{0xA77A, 0x0000, 0x0000}, {0xA77C, 0x0000, 0x0000},
+	{0x1D79, 0x0000, 0x0000}, {0xA77F, 0x0000, 0x0000},
+	{0xA781, 0x0000, 0x0000}, {0xA783, 0x0000, 0x0000},
+	{0xA785, 0x0000, 0x0000}, {0xA787, 0x0000, 0x0000},
+	{0xA78C, 0x0000, 0x0000}, {0x0265, 0x0000, 0x0000},
+	{0xA791, 0x0000, 0x0000}, {0xA793, 0x0000, 0x0000},
+	{0xA7A1, 0x0000, 0x0000}, {0xA7A3, 0x0000, 0x0000},
+	{0xA7A5, 0x0000, 0x0000}, {0xA7A7, 0x0000, 0x0000},
+	{0xA7A9, 0x0000, 0x0000}, {0x0266, 0x0000, 0x0000},
+	{0xFF41, 0x0000, 0x0000}, {0xFF42, 0x0000, 0x0000},
+	{0xFF43, 0x0000, 0x0000}, {0xFF44, 0x0000, 0x0000},
+	{0xFF45, 0x0000, 0x0000}, {0xFF46, 0x0000, 0x0000},
+	{0xFF47, 0x0000, 0x0000}, {0xFF48, 0x0000, 0x0000},
+	{0xFF49, 0x0000, 0x0000}, {0xFF4A, 0x0000, 0x0000},
+	{0xFF4B, 0x0000, 0x0000}, {0xFF4C, 0x0000, 0x0000},
+	{0xFF4D, 0x0000, 0x0000}, {0xFF4E, 0x0000, 0x0000},
+	{0xFF4F, 0x0000, 0x0000}, {0xFF50, 0x0000, 0x0000},
+	{0xFF51, 0x0000, 0x0000}, {0xFF52, 0x0000, 0x0000},
+	{0xFF53, 0x0000, 0x0000}, {0xFF54, 0x0000, 0x0000},
+	{0xFF55, 0x0000, 0x0000}, {0xFF56, 0x0000, 0x0000},
+	{0xFF57, 0x0000, 0x0000}, {0xFF58, 0x0000, 0x0000},
+	{0xFF59, 0x0000, 0x0000}, {0xFF5A, 0x0000, 0x0000},
+	{0x10428, 0x0000, 0x0000}, {0x10429, 0x0000, 0x0000},
+	{0x1042A, 0x0000, 0x0000}, {0x1042B, 0x0000, 0x0000},
+	{0x1042C, 0x0000, 0x0000}, {0x1042D, 0x0000, 0x0000},
+	{0x1042E, 0x0000, 0x0000}, {0x1042F, 0x0000, 0x0000},
+	{0x10430, 0x0000, 0x0000}, {0x10431, 0x0000, 0x0000},
+	{0x10432, 0x0000, 0x0000}, {0x10433, 0x0000, 0x0000},
+	{0x10434, 0x0000, 0x0000}, {0x10435, 0x0000, 0x0000},
+	{0x10436, 0x0000, 0x0000}, {0x10437, 0x0000, 0x0000},
+	{0x10438, 0x0000, 0x0000}, {0x10439, 0x0000, 0x0000},
+	{0x1043A, 0x0000, 0x0000}, {0x1043B, 0x0000, 0x0000},
+	{0x1043C, 0x0000, 0x0000}, {0x1043D, 0x0000, 0x0000},
+	{0x1043E, 0x0000, 0x0000}, {0x1043F, 0x0000, 0x0000},
+	{0x10440, 0x0000, 0x0000}, {0x10441, 0x0000, 0x0000},
+	{0x10442, 0x0000, 0x0000}, {0x10443, 0x0000, 0x0000},
+	{0x10444, 0x0000, 0x0000}, {0x10445, 0x0000, 0x0000},
+	{0x10446, 0x0000, 0x0000}, {0x10447, 0x0000, 0x0000},
+	{0x10448, 0x0000, 0x0000}, {0x10449, 0x0000, 0x0000},
+	{0x1044A, 0x0000, 0x0000}, {0x1044B, 0x0000, 0x0000},
+	{0x1044C, 0x0000, 0x0000}, {0x1044D, 0x0000, 0x0000},
+	{0x1044E, 0x0000, 0x0000}, {0x1044F, 0x0000, 0x0000},
+	{0x0073, 0x0073, 0x0000}, {0x02BC, 0x006E, 0x0000},
+	{0x006A, 0x030C, 0x0000}, {0x03B9, 0x0308, 0x0301},
+	{0x03C5, 0x0308, 0x0301}, {0x0565, 0x0582, 0x0000},
+	{0x0068, 0x0331, 0x0000}, {0x0074, 0x0308, 0x0000},
+	{0x0077, 0x030A, 0x0000}, {0x0079, 0x030A, 0x0000},
+	{0x0061, 0x02BE, 0x0000}, {0x03C5, 0x0313, 0x0000},
+	{0x03C5, 0x0313, 0x0300}, {0x03C5, 0x0313, 0x0301},
+	{0x03C5, 0x0313, 0x0342}, {0x1F00, 0x03B9, 0x0000},
+	{0x1F01, 0x03B9, 0x0000}, {0x1F02, 0x03B9, 0x0000},
+	{0x1F03, 0x03B9, 0x0000}, {0x1F04, 0x03B9, 0x0000},
+	{0x1F05, 0x03B9, 0x0000}, {0x1F06, 0x03B9, 0x0000},
+	{0x1F07, 0x03B9, 0x0000}, {0x1F20, 0x03B9, 0x0000},
+	{0x1F21, 0x03B9, 0x0000}, {0x1F22, 0x03B9, 0x0000},
+	{0x1F23, 0x03B9, 0x0000}, {0x1F24, 0x03B9, 0x0000},
+	{0x1F25, 0x03B9, 0x0000}, {0x1F26, 0x03B9, 0x0000},
+	{0x1F27, 0x03B9, 0x0000}, {0x1F60, 0x03B9, 0x0000},
+	{0x1F61, 0x03B9, 0x0000}, {0x1F62, 0x03B9, 0x0000},
+	{0x1F63, 0x03B9, 0x0000}, {0x1F64, 0x03B9, 0x0000},
+	{0x1F65, 0x03B9, 0x0000}, {0x1F66, 0x03B9, 0x0000},
+	{0x1F67, 0x03B9, 0x0000}, {0x1F70, 0x03B9, 0x0000},
+	{0x03B1, 0x03B9, 0x0000}, {0x03AC, 0x03B9, 0x0000},
+	{0x03B1, 0x0342, 0x0000}, {0x03B1, 0x0342, 0x03B9},
+	{0x1F74, 0x03B9, 0x0000}, {0x03B7, 0x03B9, 0x0000},
+	{0x03AE, 0x03B9, 0x0000}, {0x03B7, 0x0342, 0x0000},
+	{0x03B7, 0x0342, 0x03B9}, {0x03B9, 0x0308, 0x0300},
+	{0x03B9, 0x0342, 0x0000}, {0x03B9, 0x0308, 0x0342},
+	{0x03C5, 0x0308, 0x0300}, {0x03C1, 0x0313, 0x0000},
+	{0x03C5, 0x0342, 0x0000}, {0x03C5, 0x0308, 0x0342},
+	{0x1F7C, 0x03B9, 0x0000}, {0x03C9, 0x03B9, 0x0000},
+	{0x03CE, 0x03B9, 0x0000}, {0x03C9, 0x0342, 0x0000},
+	{0x03C9, 0x0342, 0x03B9}, {0x0066, 0x0066, 0x0000},
+	{0x0066, 0x0069, 0x0000}, {0x0066, 0x006C, 0x0000},
+	{0x0066, 0x0066, 0x0069}, {0x0066, 0x0066, 0x006C},
+	{0x0073, 0x0074, 0x0000}, {0x0574, 0x0576, 0x0000},
+	{0x0574, 0x0565, 0x0000}, {0x0574, 0x056B, 0x0000},
+	{0x057E, 0x0576, 0x0000}, {0x0574, 0x056D, 0x0000},
+};
+
+// Look up the chars a codepoint maps to, using one of the stage 1 tables
+// above. Returns NULL if the mapping leaves the char unchanged; otherwise
+// the result holds up to three chars, with unused entries set to zero.
+static inline const uint32_t *CaseMapping(
+		const uint16_t *stage1, uint32_t ch )
+{
+	if (ch >= CASE_TABLE_LIMIT) return 0;
+	unsigned block = stage1[ch >> CASE_BLOCK_BITS];
+	unsigned row = case_blocks[block][ch & CASE_BLOCK_MASK];
+	return row ? case_mappings[row] : 0;
+}
+
+#endif //casetables_h
@@ -20,11 +20,13 @@
 
 
 #include "closures.h"
+#include "dispatch.h"
 #include "buffer.h"
 #include "booleans.h"
 #include "allocator.h"
 #include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include "macros.h"
@@ -47,21 +49,74 @@ static value_t is_not_void_func(PREFUNC, value_t param)
 }
 struct closure is_not_void = {(function_t)is_not_void_func};
 
+// Each native type's dispatcher registers its method table here the first
+// time it is asked for a method. The cache is keyed by dispatcher address, so
+// a send can find the table from the object alone. Two types may hash to the
+// same line, in which case they take turns occupying it; a miss just means
+// the send takes the slow path through the dispatcher. Tables are immutable
+// and live forever, so publishing a pointer to one is all the
+// synchronization we need.
+#define SEND_CACHE_BITS 8
+#define SEND_CACHE_SIZE (1 << SEND_CACHE_BITS)
+static const struct method_table *sSendCache[SEND_CACHE_SIZE];
+
+static size_t SendCacheLine( function_t dispatcher )
+{
+	// Function addresses are usually aligned, so the low bits carry little
+	// information; fold some of the higher bits down over them.
+	uintptr_t addr = (uintptr_t)dispatcher;
+	addr ^= addr >> SEND_CACHE_BITS;
+	return (addr >> 4) & (SEND_CACHE_SIZE - 1);
+}
+
+static value_t TableMethod( const struct method_table *table, value_t sym )
+{
+	if (!IsASymbol( sym )) return NULL;
+	uint32_t id = SymbolID( sym );
+	return id < SYMBOL_ID_COUNT ? table->methods[id] : NULL;
+}
+
+value_t LookupMethod( const struct method_table *table, value_t selector )
+{
+	const struct method_table **line =
+			&sSendCache[SendCacheLine( table->dispatcher )];
+	if (__atomic_load_n( line, __ATOMIC_RELAXED ) != table) {
+		__atomic_store_n( line, table, __ATOMIC_RELEASE );
+	}
+	return TableMethod( table, selector );
+}
+
+static value_t CachedMethod( value_t obj, value_t sym )
+{
+	const struct method_table *table = __atomic_load_n(
+			&sSendCache[SendCacheLine( obj->function )], __ATOMIC_ACQUIRE );
+	if (!table || table->dispatcher != obj->function) return NULL;
+	return TableMethod( table, sym );
+}
+
+// Sending a message used to mean two calls: one to ask the object for its
+// method, and another to invoke it. When the object's type has a method
+// table, we find the method ourselves and make only the second call. Objects
+// without a table, including everything defined in Radian code, still go
+// through their dispatchers.
 value_t method_0( zone_t zone, value_t obj, value_t sym )
 {
-	value_t method = CALL_1( obj, sym );
+	value_t method = CachedMethod( obj, sym );
+	if (!method) method = CALL_1( obj, sym );
 	return CALL_1( method, obj );
 }
 
 value_t method_1( zone_t zone, value_t obj, value_t sym, value_t arg0 )
 {
-	value_t method = CALL_1( obj, sym );
+	value_t method = CachedMethod( obj, sym );
+	if (!method) method = CALL_1( obj, sym );
 	return CALL_2( method, obj, arg0 );
 }
 
 value_t method_2(
 		zone_t zone, value_t obj, value_t sym, value_t arg0, value_t arg1 )
 {
-	value_t method = CALL_1( obj, sym );
+	value_t method = CachedMethod( obj, sym );
+	if (!method) method = CALL_1( obj, sym );
 	return CALL_3( method, obj, arg0, arg1 );
 }
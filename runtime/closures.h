@@ -36,6 +36,24 @@ typedef const struct closure *value_t;
 #define PREFUNC zone_t zone, value_t self, int argc
 typedef value_t (*function_t)(PREFUNC, ...);
 
+// Nearly every backing function takes a fixed number of arguments, even
+// though function_t is variadic. Calling one through a variadic pointer makes
+// the caller follow the varargs convention, which costs an extra register
+// setup on x86-64 and puts every argument on the stack on some other ABIs.
+// C code calls invokables through these fixed-arity types instead.
+typedef value_t (*function0_t)(PREFUNC);
+typedef value_t (*function1_t)(PREFUNC, value_t);
+typedef value_t (*function2_t)(PREFUNC, value_t, value_t);
+typedef value_t (*function3_t)(PREFUNC, value_t, value_t, value_t);
+typedef value_t (*function4_t)(PREFUNC, value_t, value_t, value_t, value_t);
+
+// No backing function is variadic. A function which accepts any number of
+// arguments, such as the tuple constructor, takes them spilled into an array
+// instead, with argc giving their count. Nothing records which form a closure
+// expects, so only callers which know their target, like the compiler when it
+// builds a tuple, may use the spill form.
+typedef value_t (*function_spill_t)(PREFUNC, const value_t *args);
+
 struct closure
 {
 	function_t function;
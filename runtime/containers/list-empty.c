@@ -25,6 +25,8 @@
 #include "numbers.h"
 #include "symbols.h"
 #include "tuples.h"
+#include "lists.h"
+#include "dispatch.h"
 #include "macros.h"
 
 static value_t Empty_function( PREFUNC, value_t selector );
@@ -108,6 +110,36 @@ static value_t Empty_insert( PREFUNC, value_t listObj,
 	return AllocSingleItemList( zone, value );
 }
 
+static value_t Empty_slice(
+		PREFUNC, value_t listObj, value_t skip, value_t count )
+{
+	ARGCHECK_3( listObj, skip, count );
+	return SliceList( zone, listObj, skip, count );
+}
+
+static const struct method_table Empty_methods = {
+	(function_t)Empty_function,
+	{
+		METHOD_ENTRY(push, Empty_add),
+		METHOD_ENTRY(pop, Empty_fail),
+		METHOD_ENTRY(head, Empty_fail),
+		METHOD_ENTRY(append, Empty_add),
+		METHOD_ENTRY(chop, Empty_fail),
+		METHOD_ENTRY(tail, Empty_fail),
+		METHOD_ENTRY(size, Empty_size),
+		METHOD_CLOSURE(is_empty, &True_returner),
+		METHOD_ENTRY(iterate, Empty_iterate),
+		METHOD_ENTRY(reverse, Empty_reverse),
+		METHOD_ENTRY(partition, Empty_partition),
+		METHOD_ENTRY(concatenate, Empty_concatenate),
+		METHOD_ENTRY(lookup, Empty_fail),
+		METHOD_ENTRY(slice, Empty_slice),
+		METHOD_ENTRY(insert, Empty_insert),
+		METHOD_ENTRY(remove, Empty_fail),
+		METHOD_ENTRY(assign, Empty_fail),
+	}
+};
+
 static value_t Empty_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
@@ -115,21 +147,6 @@ static value_t Empty_function( PREFUNC, value_t selector )
 	// which actually work are the ones that ask for information about size and
 	// the ones that add an entry to the list. Adding an entry to the empty
 	// list pushes us up to the next category: the single-element list.
-	DEFINE_METHOD(push, Empty_add)
-	DEFINE_METHOD(pop, Empty_fail)
-	DEFINE_METHOD(head, Empty_fail)
-	DEFINE_METHOD(append, Empty_add)
-	DEFINE_METHOD(chop, Empty_fail)
-	DEFINE_METHOD(tail, Empty_fail)
-	DEFINE_METHOD(size, Empty_size)
-	if (sym_is_empty == selector) return &True_returner;
-	DEFINE_METHOD(iterate, Empty_iterate)
-	DEFINE_METHOD(reverse, Empty_reverse)
-	DEFINE_METHOD(partition, Empty_partition)
-	DEFINE_METHOD(concatenate, Empty_concatenate)
-	DEFINE_METHOD(lookup, Empty_fail)
-	DEFINE_METHOD(insert, Empty_insert)
-	DEFINE_METHOD(remove, Empty_fail)
-	DEFINE_METHOD(assign, Empty_fail)
+	DISPATCH_METHODS( Empty_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
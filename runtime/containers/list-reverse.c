@@ -25,6 +25,8 @@
 #include "booleans.h"
 #include "numbers.h"
 #include "tuples.h"
+#include "lists.h"
+#include "dispatch.h"
 #include "macros.h"
 
 static value_t List_reverse_func( PREFUNC, value_t selector );
@@ -135,12 +137,19 @@ static value_t List_iterator_next( PREFUNC, value_t iterator )
 	}
 }
 
+static const struct method_table List_iterator_methods = {
+	(function_t)List_iterator_func,
+	{
+		METHOD_CLOSURE(is_valid, &True_returner),
+		METHOD_ENTRY(current, List_iterator_current),
+		METHOD_ENTRY(next, List_iterator_next),
+	}
+};
+
 static value_t List_iterator_func( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	if (sym_is_valid == selector) return &True_returner;
-	DEFINE_METHOD(current, List_iterator_current)
-	DEFINE_METHOD(next, List_iterator_next)
+	DISPATCH_METHODS( List_iterator_methods );
 	return ThrowCStr( zone, "iterator does not have that method" );
 }
 
@@ -169,7 +178,10 @@ static value_t List_partition( PREFUNC, value_t wrapper, value_t indexObj)
 {
 	ARGCHECK_2( wrapper, indexObj );
 	value_t listObj = wrapper->slots[LIST_REVERSE_LIST_SLOT];
-	indexObj = FlipIndex( zone, listObj, indexObj );
+	// A partition index falls between two elements, not on one, so it flips
+	// around the size rather than around the last element's index.
+	value_t size = METHOD_0( listObj, sym_size );
+	indexObj = METHOD_1( size, sym_subtract, indexObj );
 	value_t splits = METHOD_1( listObj, sym_partition, indexObj );
 	// We have split the wrapped method - now we need to reverse the resulting
 	// lists and return them in opposite order.
@@ -241,27 +253,42 @@ static value_t List_assign( PREFUNC, value_t wrapper,
 	return METHOD_0( listObj, sym_reverse );
 }
 
+static value_t List_slice(
+		PREFUNC, value_t listObj, value_t skip, value_t count )
+{
+	ARGCHECK_3( listObj, skip, count );
+	return SliceList( zone, listObj, skip, count );
+}
+
+static const struct method_table List_reverse_methods = {
+	(function_t)List_reverse_func,
+	{
+		METHOD_ENTRY(push, List_push),
+		METHOD_ENTRY(pop, List_pop),
+		METHOD_ENTRY(head, List_head),
+		METHOD_ENTRY(append, List_append),
+		METHOD_ENTRY(chop, List_chop),
+		METHOD_ENTRY(tail, List_tail),
+		METHOD_ENTRY(size, List_size),
+		METHOD_CLOSURE(is_empty, &False_returner),
+		METHOD_ENTRY(iterate, List_iterate),
+		METHOD_ENTRY(reverse, List_reverse),
+		METHOD_ENTRY(partition, List_partition),
+		METHOD_ENTRY(concatenate, List_concatenate),
+		METHOD_ENTRY(lookup, List_lookup),
+		METHOD_ENTRY(slice, List_slice),
+		METHOD_ENTRY(insert, List_insert),
+		METHOD_ENTRY(remove, List_remove),
+		METHOD_ENTRY(assign, List_assign),
+	}
+};
+
 static value_t List_reverse_func( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
 	// Reversed interface to a list. This MUST implement all the same methods
 	// as the full list.
-	DEFINE_METHOD(push, List_push)
-	DEFINE_METHOD(pop, List_pop)
-	DEFINE_METHOD(head, List_head)
-	DEFINE_METHOD(append, List_append)
-	DEFINE_METHOD(chop, List_chop)
-	DEFINE_METHOD(tail, List_tail)
-	DEFINE_METHOD(size, List_size)
-	if (sym_is_empty == selector) return &False_returner;
-	DEFINE_METHOD(iterate, List_iterate);
-	DEFINE_METHOD(reverse, List_reverse);
-	DEFINE_METHOD(partition, List_partition);
-	DEFINE_METHOD(concatenate, List_concatenate);
-	DEFINE_METHOD(lookup, List_lookup)
-	DEFINE_METHOD(insert, List_insert)
-	DEFINE_METHOD(remove, List_remove)
-	DEFINE_METHOD(assign, List_assign);
+	DISPATCH_METHODS( List_reverse_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
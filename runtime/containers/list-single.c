@@ -27,6 +27,7 @@
 #include "numbers.h"
 #include "symbols.h"
 #include "tuples.h"
+#include "dispatch.h"
 #include "macros.h"
 
 static value_t Single_function( PREFUNC, value_t selector );
@@ -227,6 +228,36 @@ static value_t Single_lookup( PREFUNC, value_t listObj, value_t indexObj )
 	return val;
 }
 
+static value_t Single_slice(
+		PREFUNC, value_t listObj, value_t skip, value_t count )
+{
+	ARGCHECK_3( listObj, skip, count );
+	return SliceList( zone, listObj, skip, count );
+}
+
+static const struct method_table Single_methods = {
+	(function_t)Single_function,
+	{
+		METHOD_ENTRY(push, Single_push),
+		METHOD_ENTRY(pop, Single_chpop),
+		METHOD_ENTRY(head, Single_value),
+		METHOD_ENTRY(append, Single_append),
+		METHOD_ENTRY(chop, Single_chpop),
+		METHOD_ENTRY(tail, Single_value),
+		METHOD_ENTRY(size, Single_size),
+		METHOD_CLOSURE(is_empty, &False_returner),
+		METHOD_ENTRY(iterate, Single_iterate),
+		METHOD_ENTRY(reverse, Single_reverse),
+		METHOD_ENTRY(partition, Single_partition),
+		METHOD_ENTRY(concatenate, Single_concatenate),
+		METHOD_ENTRY(lookup, Single_lookup),
+		METHOD_ENTRY(slice, Single_slice),
+		METHOD_ENTRY(insert, Single_insert),
+		METHOD_ENTRY(remove, Single_remove),
+		METHOD_ENTRY(assign, Single_assign),
+	}
+};
+
 static value_t Single_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
@@ -234,22 +265,7 @@ static value_t Single_function( PREFUNC, value_t selector )
 	// one value, head and tail are all the same. Removing this value bumps us
 	// back down to the empty list; adding a new value suddenly creates an
 	// ordering, which pushes us up to the general multi-element list function.
-	DEFINE_METHOD(push, Single_push)
-	DEFINE_METHOD(pop, Single_chpop)
-	DEFINE_METHOD(head, Single_value)
-	DEFINE_METHOD(append, Single_append)
-	DEFINE_METHOD(chop, Single_chpop)
-	DEFINE_METHOD(tail, Single_value)
-	DEFINE_METHOD(size, Single_size)
-	if (sym_is_empty == selector) return &False_returner;
-	DEFINE_METHOD(iterate, Single_iterate)
-	DEFINE_METHOD(reverse, Single_reverse)
-	DEFINE_METHOD(partition, Single_partition)
-	DEFINE_METHOD(concatenate, Single_concatenate)
-	DEFINE_METHOD(lookup, Single_lookup)
-	DEFINE_METHOD(insert, Single_insert)
-	DEFINE_METHOD(remove, Single_remove)
-	DEFINE_METHOD(assign, Single_assign)
+	DISPATCH_METHODS( Single_methods );
 	return ThrowCStr( zone, "list does not implement that method" );
 }
 
@@ -63,6 +63,8 @@
 #include "numbers.h"
 #include "booleans.h"
 #include "tuples.h"
+#include "sequences.h"
+#include "dispatch.h"
 #include "macros.h"
 
 
@@ -279,12 +281,37 @@ static value_t List_iterator_next( PREFUNC, value_t iterator )
 	return METHOD_0( target, sym_iterate );
 }
 
+static value_t List_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	// Pop elements off the list for as long as it remains a full-sized list;
+	// once it shrinks to a single item, that list's own iterator takes over.
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t target = iterator->slots[LIST_ITERATOR_LIST_SLOT];
+	value_t items[BATCH_LIMIT];
+	size_t taken = 0;
+	while (taken < limit && target->function == (function_t)List_function) {
+		items[taken++] = METHOD_0( target, sym_head );
+		target = METHOD_0( target, sym_pop );
+	}
+	value_t rest = iterator;
+	if (taken > 0) {
+		rest = METHOD_0( target, sym_iterate );
+	}
+	return MakeBatch( zone, items, taken, rest );
+}
+
 static value_t List_iterator_func( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
 	if (sym_is_valid == selector) return &True_returner;
 	DEFINE_METHOD(current, List_iterator_current)
 	DEFINE_METHOD(next, List_iterator_next)
+	DEFINE_METHOD(next_n, List_iterator_next_n)
 	return ThrowCStr( zone, "iterator does not have that method" );
 }
 
@@ -355,7 +382,7 @@ static value_t List_partition( PREFUNC, value_t listObj, value_t indexObj )
 			int old_tail_size = IntFromFixint( METHOD_0( tail_out, sym_size ) );
 			value_t temp_tail = METHOD_0( tail_out, sym_pop );
 			int new_tail_size = IntFromFixint( METHOD_0( temp_tail, sym_size ) );
-			int leaf_count = new_tail_size - old_tail_size;
+			int leaf_count = old_tail_size - new_tail_size;
 			if (leaf_count <= index) {
 				head_out = METHOD_1( head_out, sym_append, item );
 				tail_out = temp_tail;
@@ -381,8 +408,11 @@ static value_t List_partition( PREFUNC, value_t listObj, value_t indexObj )
 	// live in cold storage. We will split cold storage in half and use the two
 	// new halves as our output lists.
 	else {
-		index -= chunk_leaf_count( head_chunk );
-		indexObj = NumberFromInt( zone, index );
+		// The index within cold storage does not count our head chunk, but
+		// the straggler loop below measures the whole head list, so it needs
+		// the original index.
+		int cold_index = index - chunk_leaf_count( head_chunk );
+		indexObj = NumberFromInt( zone, cold_index );
 		value_t splits = METHOD_1( cold_storage, sym_partition, indexObj );
 		value_t cold_head = CALL_1( splits, num_zero );
 		value_t cold_tail = CALL_1( splits, num_one );
@@ -437,6 +467,33 @@ static value_t List_partition( PREFUNC, value_t listObj, value_t indexObj )
 }
 
 #include <stdio.h>
+value_t SliceList( zone_t zone, value_t list, value_t skip, value_t count )
+{
+	value_t size = METHOD_0( list, sym_size );
+	if (IsAnException( size )) return size;
+	size_t begin = 0, end = 0;
+	if (!SliceBounds( skip, count, IntFromFixint( size ), &begin, &end )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	if (0 == begin && (size_t)IntFromFixint( size ) == end) return list;
+	// Drop everything before the slice, then keep only its head.
+	value_t index = NumberFromInt( zone, begin );
+	value_t splits = METHOD_1( list, sym_partition, index );
+	if (IsAnException( splits )) return splits;
+	value_t rest = CALL_1( splits, num_one );
+	index = NumberFromInt( zone, end - begin );
+	splits = METHOD_1( rest, sym_partition, index );
+	if (IsAnException( splits )) return splits;
+	return CALL_1( splits, num_zero );
+}
+
+static value_t List_slice(
+		PREFUNC, value_t listObj, value_t skip, value_t count )
+{
+	ARGCHECK_3( listObj, skip, count );
+	return SliceList( zone, listObj, skip, count );
+}
+
 static value_t List_concatenate(
 		PREFUNC, value_t listObj, value_t otherList )
 {
@@ -619,25 +676,33 @@ static value_t List_assign( PREFUNC, value_t listObj,
 	return METHOD_1( head_list, sym_concatenate, tail_list );
 }
 
+static const struct method_table List_methods = {
+	(function_t)List_function,
+	{
+		METHOD_ENTRY(push, List_push),
+		METHOD_ENTRY(pop, List_pop),
+		METHOD_ENTRY(head, List_head),
+		METHOD_ENTRY(append, List_append),
+		METHOD_ENTRY(chop, List_chop),
+		METHOD_ENTRY(tail, List_tail),
+		METHOD_ENTRY(size, List_size),
+		METHOD_CLOSURE(is_empty, &False_returner),
+		METHOD_ENTRY(iterate, List_iterate),
+		METHOD_ENTRY(reverse, List_reverse),
+		METHOD_ENTRY(partition, List_partition),
+		METHOD_ENTRY(concatenate, List_concatenate),
+		METHOD_ENTRY(lookup, List_lookup),
+		METHOD_ENTRY(slice, List_slice),
+		METHOD_ENTRY(insert, List_insert),
+		METHOD_ENTRY(remove, List_remove),
+		METHOD_ENTRY(assign, List_assign),
+	}
+};
+
 static value_t List_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(push, List_push)
-	DEFINE_METHOD(pop, List_pop)
-	DEFINE_METHOD(head, List_head)
-	DEFINE_METHOD(append, List_append)
-	DEFINE_METHOD(chop, List_chop)
-	DEFINE_METHOD(tail, List_tail)
-	DEFINE_METHOD(size, List_size)
-	if (sym_is_empty == selector) return &False_returner;
-	DEFINE_METHOD(iterate, List_iterate);
-	DEFINE_METHOD(reverse, List_reverse);
-	DEFINE_METHOD(partition, List_partition);
-	DEFINE_METHOD(concatenate, List_concatenate);
-	DEFINE_METHOD(lookup, List_lookup);
-	DEFINE_METHOD(insert, List_insert)
-	DEFINE_METHOD(remove, List_remove)
-	DEFINE_METHOD(assign, List_assign);
+	DISPATCH_METHODS( List_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
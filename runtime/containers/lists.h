@@ -27,4 +27,8 @@ extern struct closure list;
 
 value_t AllocTwoItemList( zone_t zone, value_t head, value_t tail );
 
+// Every list variant implements slice by partitioning itself twice; see
+// sequences.h for the meaning of the arguments.
+value_t SliceList( zone_t zone, value_t list, value_t skip, value_t count );
+
 #endif	//lists_h
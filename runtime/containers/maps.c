@@ -40,6 +40,7 @@
 #include <assert.h>
 #include <stdbool.h>
 #include "libradian.h"
+#include "dispatch.h"
 
 
 // Update make_node() below if you alter any of these values.
@@ -525,12 +526,19 @@ static value_t Maperator_Current( PREFUNC, value_t iterator )
 	return AllocPair( zone, key, value );
 }
 
+static const struct method_table Maperator_methods = {
+	(function_t)Maperator_function,
+	{
+		METHOD_ENTRY(next, Maperator_Next),
+		METHOD_ENTRY(current, Maperator_Current),
+		METHOD_CLOSURE(is_valid, &True_returner),
+	}
+};
+
 static value_t Maperator_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(next, Maperator_Next)
-	DEFINE_METHOD(current, Maperator_Current)
-	if (selector == sym_is_valid) return &True_returner;
+	DISPATCH_METHODS( Maperator_methods );
 	return ThrowCStr(
 			zone, "the map iterator does not have the requested method");
 }
@@ -573,19 +581,26 @@ static value_t Map_Size( PREFUNC, value_t map_obj )
 	return get_size( zone, map_obj );
 }
 
+static const struct method_table Map_methods = {
+	(function_t)Map_function,
+	{
+		METHOD_ENTRY(contains, Map_Contains),
+		METHOD_ENTRY(iterate, Map_Iterate),
+		METHOD_ENTRY(insert, Map_Insert),
+		METHOD_ENTRY(assign, Map_Insert),
+		METHOD_ENTRY(remove, Map_Remove),
+		METHOD_ENTRY(lookup, Map_Lookup),
+		METHOD_ENTRY(size, Map_Size),
+	}
+};
+
 static value_t Map_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(contains, Map_Contains)
-	DEFINE_METHOD(iterate, Map_Iterate)
+	DISPATCH_METHODS( Map_methods );
 	if (sym_is_empty == selector) {
 		return self == &map_blank ? &True_returner : &False_returner;
 	}
-	DEFINE_METHOD(insert, Map_Insert)
-	DEFINE_METHOD(assign, Map_Insert)
-	DEFINE_METHOD(remove, Map_Remove)
-	DEFINE_METHOD(lookup, Map_Lookup)
-	DEFINE_METHOD(size, Map_Size)
 	return ThrowCStr( zone, "map does not implement that method" );
 }
 
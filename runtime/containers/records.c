@@ -0,0 +1,289 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty. 
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+// Objects and modules used to keep their members in general maps, which are
+// balanced trees ordered by compare_to. Almost every member index is small and
+// keyed only by symbols, though, so a record keeps its keys in one flat array
+// sorted by symbol ID, with the values in a parallel array after them. Symbols
+// are interned, so a small record finds a key by comparing pointers down the
+// array; a larger one binary searches by ID. Records are immutable, like
+// maps: insert and remove return a modified copy.
+//
+// If someone stores a key which is not a symbol, the record turns itself into
+// a general map and carries on from there.
+
+#include <stdbool.h>
+#include "libradian.h"
+#include "records.h"
+#include "dispatch.h"
+
+#define RECORD_SIZE_SLOT 0
+#define RECORD_KEYS_SLOT 1
+#define RECORD_SLOT_COUNT(count) (RECORD_KEYS_SLOT + 2 * (count))
+
+// Up to this many keys, a straight scan beats the binary search.
+#define RECORD_SCAN_LIMIT 8
+
+#define RECORDER_SLOT_COUNT 2
+#define RECORDER_TARGET_SLOT 0
+#define RECORDER_INDEX_SLOT 1
+
+static value_t Record_function( PREFUNC, value_t selector );
+static value_t Recorder_function( PREFUNC, value_t selector );
+static value_t Recorder_done_function( PREFUNC, value_t selector );
+
+static struct closure Recorder_done = {(function_t)Recorder_done_function};
+
+static size_t RecordCount( value_t record )
+{
+	if (record == &record_blank) return 0;
+	return IntFromFixint( record->slots[RECORD_SIZE_SLOT] );
+}
+
+static const value_t *RecordKeys( value_t record )
+{
+	return &record->slots[RECORD_KEYS_SLOT];
+}
+
+static const value_t *RecordValues( value_t record, size_t count )
+{
+	return &record->slots[RECORD_KEYS_SLOT + count];
+}
+
+static size_t SearchKeys( const value_t *keys, size_t count, value_t key )
+{
+	// Return the index of the key, or the index where it would go.
+	if (count <= RECORD_SCAN_LIMIT) {
+		for (size_t i = 0; i < count; i++) {
+			if (keys[i] == key) return i;
+		}
+	}
+	uint32_t id = SymbolID( key );
+	size_t low = 0, high = count;
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		if (SymbolID( keys[mid] ) < id) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+static bool FindKey( value_t record, value_t key, size_t *index )
+{
+	size_t count = RecordCount( record );
+	if (!IsASymbol( key )) return false;
+	*index = SearchKeys( RecordKeys( record ), count, key );
+	return *index < count && RecordKeys( record )[*index] == key;
+}
+
+static struct closure *AllocRecord( zone_t zone, size_t count )
+{
+	struct closure *out = ALLOC( Record_function, RECORD_SLOT_COUNT(count) );
+	out->slots[RECORD_SIZE_SLOT] = NumberFromInt( zone, count );
+	return out;
+}
+
+static value_t RecordToMap( zone_t zone, value_t record )
+{
+	size_t count = RecordCount( record );
+	const value_t *keys = RecordKeys( record );
+	const value_t *values = RecordValues( record, count );
+	value_t out = &map_blank;
+	for (size_t i = 0; i < count && !IsAnException( out ); i++) {
+		out = METHOD_2( out, sym_insert, keys[i], values[i] );
+	}
+	return out;
+}
+
+static value_t Record_Insert(
+		PREFUNC, value_t record, value_t key, value_t value )
+{
+	ARGCHECK_3( record, key, value );
+	if (!IsASymbol( key )) {
+		value_t map = RecordToMap( zone, record );
+		if (IsAnException( map )) return map;
+		return METHOD_2( map, sym_insert, key, value );
+	}
+	size_t count = RecordCount( record );
+	const value_t *keys = RecordKeys( record );
+	const value_t *values = RecordValues( record, count );
+	size_t index = 0;
+	if (FindKey( record, key, &index )) {
+		// Replace the existing value, keeping the keys as they were.
+		struct closure *out = AllocRecord( zone, count );
+		for (size_t i = RECORD_KEYS_SLOT; i < RECORD_SLOT_COUNT(count); i++) {
+			out->slots[i] = record->slots[i];
+		}
+		out->slots[RECORD_KEYS_SLOT + count + index] = value;
+		return out;
+	}
+	struct closure *out = AllocRecord( zone, count + 1 );
+	value_t *new_keys = &out->slots[RECORD_KEYS_SLOT];
+	value_t *new_values = &out->slots[RECORD_KEYS_SLOT + count + 1];
+	for (size_t i = 0; i < index; i++) {
+		new_keys[i] = keys[i];
+		new_values[i] = values[i];
+	}
+	new_keys[index] = key;
+	new_values[index] = value;
+	for (size_t i = index; i < count; i++) {
+		new_keys[i + 1] = keys[i];
+		new_values[i + 1] = values[i];
+	}
+	return out;
+}
+
+static value_t Record_Remove( PREFUNC, value_t record, value_t key )
+{
+	ARGCHECK_2( record, key );
+	// Like the map, we quietly return the record unchanged if the key is not
+	// present.
+	size_t index = 0;
+	if (!FindKey( record, key, &index )) return record;
+	size_t count = RecordCount( record );
+	if (1 == count) return &record_blank;
+	const value_t *keys = RecordKeys( record );
+	const value_t *values = RecordValues( record, count );
+	struct closure *out = AllocRecord( zone, count - 1 );
+	value_t *new_keys = &out->slots[RECORD_KEYS_SLOT];
+	value_t *new_values = &out->slots[RECORD_KEYS_SLOT + count - 1];
+	for (size_t i = 0, j = 0; i < count; i++) {
+		if (i == index) continue;
+		new_keys[j] = keys[i];
+		new_values[j] = values[i];
+		j++;
+	}
+	return out;
+}
+
+static value_t Record_Lookup( PREFUNC, value_t record, value_t key )
+{
+	ARGCHECK_2( record, key );
+	size_t index = 0;
+	if (FindKey( record, key, &index )) {
+		return RecordValues( record, RecordCount( record ) )[index];
+	}
+	value_t message = StringFromCStr( zone, "key not found" );
+	return Throw( zone, AllocPair( zone, message, key ) );
+}
+
+static value_t Record_Contains( PREFUNC, value_t record, value_t key )
+{
+	ARGCHECK_2( record, key );
+	size_t index = 0;
+	return BooleanFromBool( FindKey( record, key, &index ) );
+}
+
+static value_t Record_Size( PREFUNC, value_t record )
+{
+	ARGCHECK_1( record );
+	return NumberFromInt( zone, RecordCount( record ) );
+}
+
+static value_t Recorder_Make( zone_t zone, value_t record, size_t index )
+{
+	if (index >= RecordCount( record )) return &Recorder_done;
+	struct closure *out = ALLOC( Recorder_function, RECORDER_SLOT_COUNT );
+	out->slots[RECORDER_TARGET_SLOT] = record;
+	out->slots[RECORDER_INDEX_SLOT] = NumberFromInt( zone, index );
+	return out;
+}
+
+static value_t Record_Iterate( PREFUNC, value_t record )
+{
+	ARGCHECK_1( record );
+	// Entries come out in symbol ID order, not in the order compare_to would
+	// put them, as they would from a map.
+	return Recorder_Make( zone, record, 0 );
+}
+
+static value_t Recorder_Next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t record = iterator->slots[RECORDER_TARGET_SLOT];
+	size_t index = IntFromFixint( iterator->slots[RECORDER_INDEX_SLOT] );
+	return Recorder_Make( zone, record, index + 1 );
+}
+
+static value_t Recorder_Current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t record = iterator->slots[RECORDER_TARGET_SLOT];
+	size_t index = IntFromFixint( iterator->slots[RECORDER_INDEX_SLOT] );
+	size_t count = RecordCount( record );
+	value_t key = RecordKeys( record )[index];
+	value_t value = RecordValues( record, count )[index];
+	return AllocPair( zone, key, value );
+}
+
+static const struct method_table Recorder_methods = {
+	(function_t)Recorder_function,
+	{
+		METHOD_ENTRY(next, Recorder_Next),
+		METHOD_ENTRY(current, Recorder_Current),
+		METHOD_CLOSURE(is_valid, &True_returner),
+	}
+};
+
+static value_t Recorder_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Recorder_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t Recorder_done_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	if (selector == sym_is_valid) return &False_returner;
+	if (selector == sym_current || selector == sym_next) {
+		return ThrowCStr( zone, "the iterator is not valid" );
+	}
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static const struct method_table Record_methods = {
+	(function_t)Record_function,
+	{
+		METHOD_ENTRY(contains, Record_Contains),
+		METHOD_ENTRY(iterate, Record_Iterate),
+		METHOD_ENTRY(insert, Record_Insert),
+		METHOD_ENTRY(assign, Record_Insert),
+		METHOD_ENTRY(remove, Record_Remove),
+		METHOD_ENTRY(lookup, Record_Lookup),
+		METHOD_ENTRY(size, Record_Size),
+	}
+};
+
+static value_t Record_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Record_methods );
+	if (sym_is_empty == selector) {
+		return self == &record_blank ? &True_returner : &False_returner;
+	}
+	return ThrowMemberNotFound( zone, selector );
+}
+
+const struct closure record_blank = {(function_t)Record_function};
@@ -0,0 +1,32 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty. 
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef records_h
+#define records_h
+
+#include "../closures.h"
+
+// A record is a member index for an object or module: a small map whose keys
+// are all symbols. It offers the same methods as a map, so anything that
+// works on an object's member map works on a record too.
+extern const struct closure record_blank;
+
+#endif	//records_h
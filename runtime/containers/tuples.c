@@ -23,12 +23,13 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdlib.h>
-#include <stdarg.h>
 #include "numbers.h"
 #include "symbols.h"
 #include "exceptions.h"
 #include "../atoms/stringliterals.h"
 #include "booleans.h"
+#include "sequences.h"
+#include "dispatch.h"
 #include "macros.h"
 
 #define TUPLE_SLOT_COUNT 1
@@ -38,6 +39,7 @@
 #define TUPLE_ITERATOR_TARGET_SLOT 0
 #define TUPLE_ITERATOR_INDEX_SLOT 1
 
+static value_t Tuple_function( PREFUNC, value_t selector );
 static value_t Tuple_iterator_function( PREFUNC, value_t iterator );
 
 // Implementations of the tuple object methods:
@@ -69,6 +71,26 @@ static value_t Tuple_lookup( PREFUNC, value_t tuple, value_t selector )
 	return tuple->slots[TUPLE_SLOT_COUNT + index];
 }
 
+static value_t Tuple_slice(
+		PREFUNC, value_t tuple, value_t skip, value_t count )
+{
+	ARGCHECK_3( tuple, skip, count );
+	size_t elements = IntFromFixint( tuple->slots[TUPLE_SIZE_SLOT] );
+	size_t begin = 0, end = 0;
+	if (!SliceBounds( skip, count, elements, &begin, &end )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	if (0 == begin && elements == end) return tuple;
+	size_t length = end - begin;
+	struct closure *out = ALLOC( Tuple_function, TUPLE_SLOT_COUNT + length );
+	out->slots[TUPLE_SIZE_SLOT] = NumberFromInt( zone, length );
+	for (size_t i = 0; i < length; i++) {
+		out->slots[TUPLE_SLOT_COUNT + i] =
+				tuple->slots[TUPLE_SLOT_COUNT + begin + i];
+	}
+	return out;
+}
+
 static value_t Tuple_iterate( PREFUNC, value_t tuple )
 {
 	ARGCHECK_1( tuple );
@@ -79,6 +101,17 @@ static value_t Tuple_iterate( PREFUNC, value_t tuple )
 	return out;
 }
 
+static const struct method_table Tuple_methods = {
+	(function_t)Tuple_function,
+	{
+		METHOD_ENTRY(is_empty, Tuple_is_empty),
+		METHOD_ENTRY(iterate, Tuple_iterate),
+		METHOD_ENTRY(size, Tuple_size_returner),
+		METHOD_ENTRY(lookup, Tuple_lookup),
+		METHOD_ENTRY(slice, Tuple_slice),
+	}
+};
+
 static value_t Tuple_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
@@ -92,10 +125,7 @@ static value_t Tuple_function( PREFUNC, value_t selector )
 		static struct closure lookerupper = {(function_t)Tuple_lookup};
 		return Tuple_lookup( zone, &lookerupper, 2, self, selector );
 	}
-	DEFINE_METHOD(is_empty, Tuple_is_empty)
-	DEFINE_METHOD(iterate, Tuple_iterate)
-	DEFINE_METHOD(size, Tuple_size_returner)
-	DEFINE_METHOD(lookup, Tuple_lookup)
+	DISPATCH_METHODS( Tuple_methods );
 	return ThrowCStr( zone, "tuple does not have that member" );
 }
 
@@ -129,27 +159,56 @@ static value_t Tuple_iterator_next( PREFUNC, value_t iterator )
 	return out;
 }
 
+static value_t Tuple_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	// The batch is just a slice of the tuple we are iterating over.
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t tuple = iterator->slots[TUPLE_ITERATOR_TARGET_SLOT];
+	size_t elements = IntFromFixint( tuple->slots[TUPLE_SIZE_SLOT] );
+	size_t index = IntFromFixint( iterator->slots[TUPLE_ITERATOR_INDEX_SLOT] );
+	if (index > elements) {
+		index = elements;
+	}
+	if (limit > elements - index) {
+		limit = elements - index;
+	}
+	struct closure *rest =
+			ALLOC(Tuple_iterator_function, TUPLE_ITERATOR_SLOT_COUNT);
+	rest->slots[TUPLE_ITERATOR_TARGET_SLOT] = tuple;
+	rest->slots[TUPLE_ITERATOR_INDEX_SLOT] =
+			NumberFromInt( zone, index + limit );
+	value_t items = TupleFromArray(
+			zone, &tuple->slots[TUPLE_SLOT_COUNT + index], limit );
+	return AllocPair( zone, items, rest );
+}
+
+static const struct method_table Tuple_iterator_methods = {
+	(function_t)Tuple_iterator_function,
+	{
+		METHOD_ENTRY(current, Tuple_iterator_current),
+		METHOD_ENTRY(is_valid, Tuple_iterator_valid),
+		METHOD_ENTRY(next, Tuple_iterator_next),
+		METHOD_ENTRY(next_n, Tuple_iterator_next_n),
+	}
+};
+
 static value_t Tuple_iterator_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(current, Tuple_iterator_current);
-	DEFINE_METHOD(is_valid, Tuple_iterator_valid);
-	DEFINE_METHOD(next, Tuple_iterator_next);
+	DISPATCH_METHODS( Tuple_iterator_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
 
-static value_t Tuple_constructor( PREFUNC, ... )
+static value_t Tuple_constructor( PREFUNC, const value_t *items )
 {
-	va_list vl;
-	va_start(vl, argc);
-	unsigned int count = argc;
-	struct closure *out = ALLOC( Tuple_function, count + TUPLE_SLOT_COUNT );
-	out->slots[TUPLE_SIZE_SLOT] = NumberFromInt( zone, count );
-	for (unsigned int i = 0; i < count; i++) {
-		out->slots[i + TUPLE_SLOT_COUNT] = va_arg(vl, value_t);
-	}
-	return out;
+	// The caller spills the tuple's items into an array; see closures.h.
+	return TupleFromArray( zone, items, argc );
 }
 
 struct closure make_tuple = {(function_t)Tuple_constructor};
@@ -175,6 +234,28 @@ value_t AllocQuadruple(
 	return out;
 }
 
+value_t TupleFromArray( zone_t zone, const value_t *items, size_t count )
+{
+	struct closure *out = ALLOC( Tuple_function, count + TUPLE_SLOT_COUNT );
+	out->slots[TUPLE_SIZE_SLOT] = NumberFromInt( zone, count );
+	for (size_t i = 0; i < count; i++) {
+		out->slots[i + TUPLE_SLOT_COUNT] = items[i];
+	}
+	return out;
+}
+
+size_t TupleSize( value_t tuple )
+{
+	assert( IsATuple( tuple ) );
+	return IntFromFixint( tuple->slots[TUPLE_SIZE_SLOT] );
+}
+
+value_t TupleItem( value_t tuple, size_t index )
+{
+	assert( index < TupleSize( tuple ) );
+	return tuple->slots[index + TUPLE_SLOT_COUNT];
+}
+
 bool IsATuple( value_t exp )
 {
 	return exp && exp->function == (function_t)Tuple_function;
@@ -21,6 +21,7 @@
 
 #include "../closures.h"
 
+// Called through the spill form, CALL_SPILL, with the tuple's items.
 extern struct closure make_tuple;
 
 value_t AllocPair( zone_t zone, value_t zero, value_t one );
@@ -28,4 +29,10 @@ value_t AllocQuadruple(
 		zone_t zone, value_t i0, value_t i1, value_t i2, value_t i3 );
 bool IsATuple( value_t exp );
 
+// Make a tuple holding a copy of some array of values, and read the items of
+// an existing tuple without going through its lookup method.
+value_t TupleFromArray( zone_t zone, const value_t *items, size_t count );
+size_t TupleSize( value_t tuple );
+value_t TupleItem( value_t tuple, size_t index );
+
 #endif //tuples_h
@@ -0,0 +1,60 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+
+#ifndef dispatch_h
+#define dispatch_h
+
+#include "closures.h"
+#include "atoms/symbols.h"
+
+// An object dispatcher used to find its method by comparing the selector
+// against each of its symbols in turn. Native types now describe their
+// methods with a table indexed by symbol ID instead, so that finding a method
+// takes one probe however many methods the type has. The dispatcher function
+// remains the object's identity; it looks the selector up in its table, then
+// falls back on whatever special handling it needs.
+struct method_table
+{
+	function_t dispatcher;
+	value_t methods[SYMBOL_ID_COUNT];
+};
+
+// Build the entries of a method table. Most entries name the C function which
+// implements the method; a few supply an existing closure, such as one of the
+// boolean returners.
+#define METHOD_ENTRY(name, function) \
+	[SYMBOL_ID(name)] = &(const struct closure){(function_t)function}
+#define METHOD_CLOSURE(name, closure) \
+	[SYMBOL_ID(name)] = (closure)
+
+// Find the selector's method in a table, or return NULL if the table has no
+// entry for it. This also remembers the table, so that later sends to objects
+// of the same type can skip the dispatcher call altogether.
+value_t LookupMethod( const struct method_table *table, value_t selector );
+
+// Begin an object dispatcher function with its table lookup.
+#define DISPATCH_METHODS(table) { \
+		value_t method = LookupMethod( &(table), selector ); \
+		if (method) return method; \
+	}
+
+#endif //dispatch_h
@@ -0,0 +1,272 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "encodings.h"
+#include "strings.h"
+#include "buffer.h"
+#include "atoms/booleans.h"
+#include "atoms/stringliterals.h"
+#include "macros.h"
+#include "exceptions.h"
+
+
+// Strings already keep their chars as UTF-8, so decoding well-formed UTF-8 is
+// a validation pass and a copy, and encoding it is just the copy. Text is
+// mostly ASCII, so each pass skips over plain ASCII a machine word at a time
+// and only drops into the char-by-char decoder when it meets a high bit.
+
+#define ASCII_WORD_MASK 0x8080808080808080ULL
+
+static size_t ASCIIPrefix( const byte_t *bytes, size_t length )
+{
+	size_t i = 0;
+	while (i + sizeof(uint64_t) <= length) {
+		uint64_t word;
+		memcpy( &word, &bytes[i], sizeof(word) );
+		if (word & ASCII_WORD_MASK) break;
+		i += sizeof(word);
+	}
+	while (i < length && bytes[i] < 0x80) {
+		i++;
+	}
+	return i;
+}
+
+static size_t ValidUTF8Prefix( const byte_t *bytes, size_t length )
+{
+	size_t i = 0;
+	while (i < length) {
+		i += ASCIIPrefix( &bytes[i], length - i );
+		if (i == length) break;
+		size_t used = 0;
+		int ch = 0;
+		if (!DecodeUTF8Sequence( &bytes[i], length - i, &used, &ch )) break;
+		i += used;
+	}
+	return i;
+}
+
+static void WriteRepairedUTF8(
+		struct byte_sink *sink, const byte_t *bytes, size_t length )
+{
+	// Copy the valid runs through untouched and replace each malformed
+	// subsequence with U+FFFD.
+	static const byte_t replacement[] = {0xEF, 0xBF, 0xBD};
+	size_t i = 0;
+	while (i < length) {
+		size_t valid = ValidUTF8Prefix( &bytes[i], length - i );
+		SinkWrite( sink, &bytes[i], valid );
+		i += valid;
+		if (i < length) {
+			size_t used = 0;
+			int ch = 0;
+			DecodeUTF8Sequence( &bytes[i], length - i, &used, &ch );
+			SinkWrite( sink, replacement, sizeof(replacement) );
+			i += used;
+		}
+	}
+}
+
+static value_t StringFromSink( zone_t zone, struct byte_sink *sink )
+{
+	value_t out = StringFromUTF8Bytes(
+			zone, (const char*)sink->data, sink->length );
+	free( sink->data );
+	return out;
+}
+
+static value_t utf8_decode_function( PREFUNC, value_t bytes )
+{
+	ARGCHECK_1( bytes );
+	value_t buf = BufferFromSequence( zone, bytes );
+	if (IsAnException( buf )) return buf;
+	const byte_t *src = NULL;
+	size_t length = 0;
+	BufferBytes( buf, &src, &length );
+	// Well-formed input becomes a string with a single copy.
+	if (ValidUTF8Prefix( src, length ) == length) {
+		return StringFromUTF8Bytes( zone, (const char*)src, length );
+	}
+	struct byte_sink sink = {NULL, 0, 0};
+	WriteRepairedUTF8( &sink, src, length );
+	return StringFromSink( zone, &sink );
+}
+const struct closure utf8_decode = {(function_t)utf8_decode_function};
+
+static value_t utf8_encode_function( PREFUNC, value_t str )
+{
+	ARGCHECK_1( str );
+	const byte_t *src = NULL;
+	size_t length = 0;
+	if (StringBytes( str, &src, &length ) &&
+			ValidUTF8Prefix( src, length ) == length) {
+		struct buffer *out = Buffer( zone, length );
+		memcpy( out->bytes, src, length );
+		return (value_t)out;
+	}
+	struct byte_sink sink = {NULL, 0, 0};
+	struct string_chunks chunks;
+	BeginStringChunks( &chunks, str );
+	while (NextStringChunk( zone, &chunks, &src, &length )) {
+		WriteRepairedUTF8( &sink, src, length );
+	}
+	EndStringChunks( &chunks );
+	if (chunks.error) {
+		free( sink.data );
+		return chunks.error;
+	}
+	return BufferFromSink( zone, &sink );
+}
+const struct closure utf8_encode = {(function_t)utf8_encode_function};
+
+static unsigned ReadUnit( const byte_t *src, bool big_endian )
+{
+	return big_endian ? (src[0] << 8) | src[1] : src[0] | (src[1] << 8);
+}
+
+static void WriteUnit( byte_t *dest, unsigned unit, bool big_endian )
+{
+	dest[big_endian ? 0 : 1] = (byte_t)(unit >> 8);
+	dest[big_endian ? 1 : 0] = (byte_t)(unit & 0xFF);
+}
+
+static value_t utf16_decode_function(
+		PREFUNC, value_t bytes, value_t big_endian_flag )
+{
+	ARGCHECK_2( bytes, big_endian_flag );
+	value_t buf = BufferFromSequence( zone, bytes );
+	if (IsAnException( buf )) return buf;
+	bool big_endian = BoolFromBoolean( zone, big_endian_flag );
+	const byte_t *src = NULL;
+	size_t length = 0;
+	BufferBytes( buf, &src, &length );
+
+	// A code unit in the ASCII range has a zero high byte and a low byte with
+	// a clear top bit. Lay the mask out in memory order, so that it works
+	// whatever the host's own byte order may be.
+	static const byte_t le_pattern[] =
+			{0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF};
+	static const byte_t be_pattern[] =
+			{0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80, 0xFF, 0x80};
+	uint64_t ascii_mask;
+	memcpy( &ascii_mask, big_endian ? be_pattern : le_pattern, 8 );
+	size_t low = big_endian ? 1 : 0;
+
+	// Each two-byte unit becomes at most three bytes of UTF-8, and each four
+	// byte surrogate pair becomes four, so we can reserve the output up front.
+	struct byte_sink sink = {NULL, 0, 0};
+	SinkReserve( &sink, (length / 2) * 3 + 3 );
+	byte_t *dest = sink.data;
+	size_t out = 0;
+	size_t i = 0;
+	while (i + 1 < length) {
+		uint64_t word;
+		if (i + sizeof(word) <= length) {
+			memcpy( &word, &src[i], sizeof(word) );
+			if (0 == (word & ascii_mask)) {
+				dest[out++] = src[i + low];
+				dest[out++] = src[i + 2 + low];
+				dest[out++] = src[i + 4 + low];
+				dest[out++] = src[i + 6 + low];
+				i += sizeof(word);
+				continue;
+			}
+		}
+		unsigned unit = ReadUnit( &src[i], big_endian );
+		i += 2;
+		int ch = unit;
+		if (unit >= 0xD800 && unit <= 0xDBFF) {
+			// Leading half of a surrogate pair; it is only meaningful if the
+			// trailing half comes next.
+			unsigned next = (i + 1 < length) ?
+					ReadUnit( &src[i], big_endian ) : 0;
+			if (next >= 0xDC00 && next <= 0xDFFF) {
+				ch = 0x10000 + ((unit - 0xD800) << 10) + (next - 0xDC00);
+				i += 2;
+			} else {
+				ch = 0xFFFD;
+			}
+		} else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+			ch = 0xFFFD;
+		}
+		out += EncodeUTF8( ch, &dest[out] );
+	}
+	if (length & 1) {
+		// A stray byte at the end cannot be a whole code unit.
+		out += EncodeUTF8( 0xFFFD, &dest[out] );
+	}
+	sink.length = out;
+	return StringFromSink( zone, &sink );
+}
+const struct closure utf16_decode = {(function_t)utf16_decode_function};
+
+static value_t utf16_encode_function(
+		PREFUNC, value_t str, value_t big_endian_flag )
+{
+	ARGCHECK_2( str, big_endian_flag );
+	bool big_endian = BoolFromBoolean( zone, big_endian_flag );
+	size_t low = big_endian ? 1 : 0;
+	struct byte_sink sink = {NULL, 0, 0};
+	struct string_chunks chunks;
+	BeginStringChunks( &chunks, str );
+	const byte_t *src = NULL;
+	size_t length = 0;
+	while (NextStringChunk( zone, &chunks, &src, &length )) {
+		// No UTF-8 sequence produces more than twice its own length in
+		// UTF-16, so one reservation covers the whole chunk.
+		SinkReserve( &sink, length * 2 );
+		byte_t *dest = &sink.data[sink.length];
+		size_t i = 0;
+		while (i < length) {
+			size_t ascii = ASCIIPrefix( &src[i], length - i );
+			for (size_t end = i + ascii; i < end; i++) {
+				dest[low] = src[i];
+				dest[1 - low] = 0;
+				dest += 2;
+			}
+			if (i == length) break;
+			size_t used = 0;
+			int ch = 0;
+			DecodeUTF8Sequence( &src[i], length - i, &used, &ch );
+			i += used;
+			if (ch < 0x10000) {
+				WriteUnit( dest, ch, big_endian );
+				dest += 2;
+			} else {
+				ch -= 0x10000;
+				WriteUnit( dest, 0xD800 | ((ch >> 10) & 0x03FF), big_endian );
+				WriteUnit( dest + 2, 0xDC00 | (ch & 0x03FF), big_endian );
+				dest += 4;
+			}
+		}
+		sink.length = dest - sink.data;
+	}
+	EndStringChunks( &chunks );
+	if (chunks.error) {
+		free( sink.data );
+		return chunks.error;
+	}
+	return BufferFromSink( zone, &sink );
+}
+const struct closure utf16_encode = {(function_t)utf16_encode_function};
@@ -0,0 +1,38 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef encodings_h
+#define encodings_h
+
+#include "closures.h"
+
+// Builtin entrypoints for the encoding library's Unicode transcoders. The
+// decoders accept a byte buffer, or any other sequence of byte values, and
+// return a string literal; malformed input decodes as U+FFFD, just as the
+// old Radian implementation did. The encoders accept any string and return a
+// byte buffer. The UTF-16 functions take a second, boolean parameter which
+// selects big-endian rather than little-endian byte order.
+extern const struct closure utf8_decode;
+extern const struct closure utf8_encode;
+extern const struct closure utf16_decode;
+extern const struct closure utf16_encode;
+
+#endif //encodings_h
@@ -27,6 +27,11 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "stringliterals.h"
 #include "symbols.h"
 #include "exceptions.h"
@@ -34,6 +39,10 @@
 #include "booleans.h"
 #include "buffer.h"
 #include "macros.h"
+#include "threads.h"
+
+// Files at least this large are mapped into memory rather than read.
+#define MAPPED_FILE_THRESHOLD (256 * 1024)
 
 value_t IOAction_Print_1( PREFUNC, value_t action )
 {
@@ -79,39 +88,115 @@ value_t IOAction_Input_0( PREFUNC, value_t action )
 	return newString;
 }
 
-static FILE *open_file( zone_t zone, value_t file, const char *mode )
+static int open_descriptor( zone_t zone, value_t file, int flags )
 {
-	// We consider anything which offers a 'path' string to be a file
-	// specification.
-	if (IsAnException( file )) return NULL;
+	if (IsAnException( file )) return -1;
 	const char *path = UnpackString( zone, file );
-	if (!path) return NULL;
-	FILE *out = fopen( path, mode );
+	if (!path) return -1;
+	int out = open( path, flags, 0666 );
 	free( (void*)path );
 	return out;
 }
 
-static value_t IOAction_ReadFile_1( PREFUNC, value_t action )
+// Every file we have ever mapped, by device and inode. We never unmap them,
+// so the table only grows.
+struct mapped_file
 {
-	assert( IsAnIOAction( action ) );
-	value_t file = action->slots[ IOACTION_SLOT_COUNT + 0 ];
-	FILE *fd = open_file( zone, file, "rb" );
-	if (!fd) return ThrowCStr( zone, "failed to open file" );
+	dev_t device;
+	ino_t inode;
+};
+static struct mapped_file *s_mapped_files;
+static size_t s_mapped_count;
+static size_t s_mapped_capacity;
+static thread_mutex_t s_mapped_lock;
 
-	// Find out how large the file is, so we can allocate an appropriately-
-	// sized buffer.
-	fseek( fd, 0, SEEK_END );
-	size_t length = ftell( fd );
-	fseek( fd, 0, SEEK_SET );
+void init_basicio(void)
+{
+	thread_mutex_create( &s_mapped_lock );
+}
 
-	// create a buffer to contain the data we will read, then read in the
-	// entire contents of the source file.
+static void remember_mapped_file( const struct stat *info )
+{
+	thread_mutex_lock( &s_mapped_lock );
+	if (s_mapped_count == s_mapped_capacity) {
+		s_mapped_capacity = s_mapped_capacity ? s_mapped_capacity * 2 : 8;
+		s_mapped_files = realloc(
+				s_mapped_files, s_mapped_capacity * sizeof(*s_mapped_files) );
+		assert( s_mapped_files );
+	}
+	s_mapped_files[s_mapped_count].device = info->st_dev;
+	s_mapped_files[s_mapped_count].inode = info->st_ino;
+	s_mapped_count++;
+	thread_mutex_unlock( &s_mapped_lock );
+}
+
+static bool is_mapped_file( const struct stat *info )
+{
+	bool found = false;
+	thread_mutex_lock( &s_mapped_lock );
+	for (size_t i = 0; i < s_mapped_count && !found; i++) {
+		found = s_mapped_files[i].device == info->st_dev &&
+				s_mapped_files[i].inode == info->st_ino;
+	}
+	thread_mutex_unlock( &s_mapped_lock );
+	return found;
+}
+
+static value_t read_small_file( zone_t zone, int fd, size_t length )
+{
 	struct buffer *data = Buffer( zone, length );
-	fread( data->bytes, 1, length, fd );
-	fclose( fd );
+	size_t done = 0;
+	while (done < length) {
+		ssize_t got = read( fd, &data->bytes[done], length - done );
+		if (got < 0 && EINTR == errno) continue;
+		if (got <= 0) break;
+		done += got;
+	}
+	// If the file shrank while we were reading it, return what we found.
+	if (done < length) {
+		return (value_t)clone_buffer(
+				zone, data->function, done, data->bytes );
+	}
 	return (value_t)data;
 }
 
+static value_t IOAction_ReadFile_1( PREFUNC, value_t action )
+{
+	assert( IsAnIOAction( action ) );
+	value_t file = action->slots[ IOACTION_SLOT_COUNT + 0 ];
+	int fd = open_descriptor( zone, file, O_RDONLY );
+	if (fd < 0) return ThrowCStr( zone, "failed to open file" );
+	struct stat info;
+	if (0 != fstat( fd, &info )) {
+		close( fd );
+		return ThrowCStr( zone, "failed to read file" );
+	}
+	size_t length = info.st_size;
+
+	// Large regular files are mapped into memory instead of being read. The
+	// buffer we return is only a reference to the mapping, so neither this
+	// function nor the collector ever copies the contents; the cost of
+	// reading the file is the page faults incurred by whoever looks at it.
+	// The mapping stays valid after we close the file, and we never unmap
+	// it, since we cannot tell when the last reference to it goes away; we
+	// remember the file, so that Write_File will not truncate it.
+	// Small files are cheaper to read outright, and would otherwise consume
+	// address space for good.
+	value_t out = NULL;
+	if (S_ISREG( info.st_mode ) && length >= MAPPED_FILE_THRESHOLD) {
+		void *base = mmap( NULL, length, PROT_READ, MAP_PRIVATE, fd, 0 );
+		if (MAP_FAILED != base) {
+			remember_mapped_file( &info );
+			out = MappedBuffer( zone, base, length );
+		}
+	}
+	if (!out) {
+		out = read_small_file( zone, fd, length );
+	}
+	close( fd );
+	return out;
+}
+
 static value_t Read_File_function( PREFUNC, value_t path )
 {
 	ARGCHECK_1( path );
@@ -122,58 +207,90 @@ static value_t Read_File_function( PREFUNC, value_t path )
 const struct closure Read_File = {(function_t)Read_File_function};
 
 
+static bool write_all( int fd, const byte_t *bytes, size_t length )
+{
+	// The kernel may accept less than we offered, or be interrupted before it
+	// takes anything; keep going until the whole span is written.
+	while (length > 0) {
+		ssize_t written = write( fd, bytes, length );
+		if (written < 0) {
+			if (EINTR == errno) continue;
+			return false;
+		}
+		bytes += written;
+		length -= written;
+	}
+	return true;
+}
+
 static value_t IOAction_WriteFile_2( PREFUNC, value_t action )
 {
 	assert( IsAnIOAction( action ) );
 	value_t file = action->slots[ IOACTION_SLOT_COUNT + 0 ];
 	value_t contents = action->slots[ IOACTION_SLOT_COUNT + 1 ];
+	if (IsAnException( file )) return ThrowCStr( zone, "failed to open file" );
+	const char *path = UnpackString( zone, file );
+	if (!path) return ThrowCStr( zone, "failed to open file" );
 
-	FILE *fd = open_file( zone, file, "w" );
-	if (!fd) return ThrowCStr( zone, "failed to open file" );
-
-	value_t iter = METHOD_0( contents, sym_iterate );
-
-	// Read bytes from the contents sequence until it ends. Write each byte to
-	// the file. It might be nice to do something with buffers here, but we can
-	// worry about that later.
-	while (true) {
-		if (IsAnException( iter )) return iter;
-		value_t is_valid = METHOD_0( iter, sym_is_valid );
-		if (IsAnException( is_valid )) {
-			fclose( fd );
-			return is_valid;
-		}
-		if (!BoolFromBoolean( zone, is_valid )) break;
-
-		value_t current = METHOD_0( iter, sym_current );
-		if (IsAnException( current )) {
-			fclose( fd );
-			return current;
+	// Truncating a file we have mapped would pull its pages out from under
+	// any buffer still referring to them. Write a new file alongside it
+	// instead, then rename that into place: the old contents will live on,
+	// unnamed, for as long as the mapping does.
+	char *temp = NULL;
+	int fd = -1;
+	struct stat info;
+	if (0 == stat( path, &info ) && is_mapped_file( &info )) {
+		temp = malloc( strlen( path ) + sizeof(".XXXXXX") );
+		assert( temp );
+		strcpy( temp, path );
+		strcat( temp, ".XXXXXX" );
+		fd = mkstemp( temp );
+		if (fd >= 0) {
+			fchmod( fd, info.st_mode & 07777 );
 		}
+	} else {
+		fd = open( path, O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+	}
+	if (fd < 0) {
+		free( temp );
+		free( (void*)path );
+		return ThrowCStr( zone, "failed to open file" );
+	}
 
-		if (!IsAFixint( current )) {
-			fclose( fd );
-			return ThrowCStr(
-					zone, "output values must be numbers in the range 0..255" );
+	// Hand the contents to the kernel a span at a time. A byte buffer goes
+	// out in a single write straight from its own storage; any other sequence
+	// is packed into blocks of up to 64 KiB first.
+	value_t out = num_zero;
+	struct byte_spans spans;
+	BeginByteSpans( &spans, contents );
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	while (NextByteSpan( zone, &spans, &bytes, &length )) {
+		if (!write_all( fd, bytes, length )) {
+			out = ThrowCStr( zone, "failed to write file" );
+			break;
 		}
-		int byte = IntFromFixint( current );
-		if (byte < 0 || byte > 255) {
-			fclose( fd );
-			return ThrowCStr(
-					zone, "output values must be numbers in the range 0..255" );
+	}
+	EndByteSpans( &spans );
+	if (spans.error) {
+		out = spans.error;
+	}
+	if (0 != close( fd ) && !IsAnException( out )) {
+		out = ThrowCStr( zone, "failed to write file" );
+	}
+	if (temp) {
+		if (IsAnException( out )) {
+			unlink( temp );
+		} else if (0 != rename( temp, path )) {
+			unlink( temp );
+			out = ThrowCStr( zone, "failed to write file" );
 		}
-
-		// Write the actual byte to the actual file!
-		fputc( byte, fd );
-
-		// Now get the next iterator value so we can write the next byte. Wow
-		// what a lot of overhead.
-		iter = METHOD_0( iter, sym_next );
+		free( temp );
 	}
-	fclose( fd );
-	// Return some meaningless non-exceptional value. Do we need a 'void'?
-	// Maybe some IO-specific "success" value.
-	return num_zero;
+	free( (void*)path );
+	// On success, return some meaningless non-exceptional value. Do we need a
+	// 'void'? Maybe some IO-specific "success" value.
+	return out;
 }
 
 static value_t Write_File_function( PREFUNC, value_t path, value_t bytes )
@@ -30,6 +30,7 @@
 value_t IOAction_Print_1( PREFUNC, value_t action );
 value_t IOAction_Input_0( PREFUNC, value_t action );
 
+void init_basicio(void);
 extern const struct closure Read_File;
 extern const struct closure Write_File;
 
@@ -21,6 +21,7 @@
 #include "callout.h"
 #include "ffi-wrapper.h"
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 #include "loadexternal.h"
 #include "exceptions.h"
@@ -119,6 +120,13 @@ static void* marshal_out( zone_t zone, value_t argval, value_t marshal )
 	// Render some Radian value out as a buffer full of bytes which we can pass
 	// off to some external function.
 	value_t bytes = METHOD_1( marshal, sym_to_bytes, argval );
+	const byte_t *src = NULL;
+	size_t length = 0;
+	if (BufferBytes( bytes, &src, &length )) {
+		char *buf = malloc( length );
+		memcpy( buf, src, length );
+		return buf;
+	}
 	int bufsiz = IntFromFixint( METHOD_0( bytes, sym_size ) );
 	char *buf = malloc( bufsiz );
 	for (int i = 0; i < bufsiz; i++) {
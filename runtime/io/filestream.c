@@ -0,0 +1,444 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#include "filestream.h"
+#include "ioaction.h"
+#include "strings.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "stringliterals.h"
+#include "symbols.h"
+#include "exceptions.h"
+#include "numbers.h"
+#include "booleans.h"
+#include "buffer.h"
+#include "dispatch.h"
+#include "macros.h"
+
+// A chunk stream reads its file a chunk at a time, as its iterator advances.
+// We have no finalizers, so nothing could ever close a descriptor the stream
+// kept open; instead we open the file for each chunk, read it with pread,
+// and close it again. Before closing, we ask the kernel to start reading the
+// following chunk into the page cache, so that it is usually ready by the
+// time the program has finished with the current one. The iterators only
+// hold the path and an offset, so iterating a stream twice reads the same
+// bytes twice, as long as nobody has changed the file in the meantime.
+#define CHUNK_STREAM_SLOT_COUNT 2
+#define CHUNK_STREAM_PATH_SLOT 0
+#define CHUNK_STREAM_SIZE_SLOT 1
+
+#define CHUNK_ITERATOR_SLOT_COUNT 4
+#define CHUNK_ITERATOR_PATH_SLOT 0
+#define CHUNK_ITERATOR_SIZE_SLOT 1
+#define CHUNK_ITERATOR_OFFSET_SLOT 2
+#define CHUNK_ITERATOR_CHUNK_SLOT 3
+
+// A line stream splits the chunks of some other sequence at each linebreak.
+// Its iterator holds the current line, along with the chunk it was found in,
+// the offset just past its linebreak, and the iterator for the remaining
+// chunks. A CR at the very end of a chunk may be half of a CR-LF pair, so we
+// also remember whether to skip an LF at the start of the next chunk.
+#define LINE_STREAM_SLOT_COUNT 1
+#define LINE_STREAM_CHUNKS_SLOT 0
+
+#define LINE_ITERATOR_SLOT_COUNT 5
+#define LINE_ITERATOR_LINE_SLOT 0
+#define LINE_ITERATOR_CHUNK_SLOT 1
+#define LINE_ITERATOR_OFFSET_SLOT 2
+#define LINE_ITERATOR_CHUNKS_SLOT 3
+#define LINE_ITERATOR_SKIP_LF_SLOT 4
+
+static value_t Chunk_stream_function( PREFUNC, value_t selector );
+static value_t Chunk_iterator_function( PREFUNC, value_t selector );
+static value_t Line_stream_function( PREFUNC, value_t selector );
+static value_t Line_iterator_function( PREFUNC, value_t selector );
+static value_t Stream_done_function( PREFUNC, value_t selector );
+static struct closure Stream_done = {(function_t)Stream_done_function};
+
+// File offsets may not fit in a fixint, so we keep them in small buffers.
+static value_t OffsetValue( zone_t zone, off_t offset )
+{
+	struct buffer *out = Buffer( zone, sizeof(offset) );
+	memcpy( out->bytes, &offset, sizeof(offset) );
+	return (value_t)out;
+}
+
+static off_t OffsetFromValue( value_t value )
+{
+	off_t offset = 0;
+	memcpy( &offset, BUFFER(value)->bytes, sizeof(offset) );
+	return offset;
+}
+
+static value_t ReadChunk(
+		zone_t zone, const char *path, off_t offset, size_t size )
+{
+	int fd = open( path, O_RDONLY );
+	if (fd < 0) return ThrowCStr( zone, "failed to open file" );
+	struct buffer *chunk = Buffer( zone, size );
+	size_t done = 0;
+	while (done < size) {
+		byte_t *dest = &chunk->bytes[done];
+		ssize_t got = pread( fd, dest, size - done, offset + done );
+		if (got < 0 && EINTR == errno) continue;
+		if (got < 0) {
+			close( fd );
+			return ThrowCStr( zone, "failed to read file" );
+		}
+		if (0 == got) break;
+		done += got;
+	}
+	if (done == size) {
+		posix_fadvise( fd, offset + size, size, POSIX_FADV_WILLNEED );
+	}
+	close( fd );
+	// Only the last chunk comes up short, so it is not worth avoiding this
+	// copy.
+	if (done < size) {
+		const byte_t *bytes = chunk->bytes;
+		return (value_t)clone_buffer( zone, chunk->function, done, bytes );
+	}
+	return (value_t)chunk;
+}
+
+static value_t MakeChunkIterator(
+		zone_t zone, value_t path, value_t size, off_t offset )
+{
+	// Read the chunk at this offset right away, so that we know whether the
+	// iterator is valid.
+	const char *cpath = (const char*)BUFFER(path)->bytes;
+	value_t chunk = ReadChunk( zone, cpath, offset, IntFromFixint( size ) );
+	if (IsAnException( chunk )) return chunk;
+	if (0 == BUFFER(chunk)->size) return &Stream_done;
+	struct closure *out =
+			ALLOC( Chunk_iterator_function, CHUNK_ITERATOR_SLOT_COUNT );
+	out->slots[CHUNK_ITERATOR_PATH_SLOT] = path;
+	out->slots[CHUNK_ITERATOR_SIZE_SLOT] = size;
+	out->slots[CHUNK_ITERATOR_OFFSET_SLOT] = OffsetValue( zone, offset );
+	out->slots[CHUNK_ITERATOR_CHUNK_SLOT] = chunk;
+	return out;
+}
+
+static value_t Chunk_iterator_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	return iterator->slots[CHUNK_ITERATOR_CHUNK_SLOT];
+}
+
+static value_t Chunk_iterator_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t chunk = iterator->slots[CHUNK_ITERATOR_CHUNK_SLOT];
+	value_t position = iterator->slots[CHUNK_ITERATOR_OFFSET_SLOT];
+	off_t offset = OffsetFromValue( position );
+	return MakeChunkIterator(
+			zone,
+			iterator->slots[CHUNK_ITERATOR_PATH_SLOT],
+			iterator->slots[CHUNK_ITERATOR_SIZE_SLOT],
+			offset + BUFFER(chunk)->size );
+}
+
+static const struct method_table Chunk_iterator_methods = {
+	(function_t)Chunk_iterator_function,
+	{
+		METHOD_ENTRY(current, Chunk_iterator_current),
+		METHOD_ENTRY(next, Chunk_iterator_next),
+		METHOD_CLOSURE(is_valid, &True_returner),
+	}
+};
+
+static value_t Chunk_iterator_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Chunk_iterator_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t Chunk_stream_iterate( PREFUNC, value_t stream )
+{
+	ARGCHECK_1( stream );
+	return MakeChunkIterator(
+			zone,
+			stream->slots[CHUNK_STREAM_PATH_SLOT],
+			stream->slots[CHUNK_STREAM_SIZE_SLOT],
+			0 );
+}
+
+static const struct method_table Chunk_stream_methods = {
+	(function_t)Chunk_stream_function,
+	{
+		METHOD_ENTRY(iterate, Chunk_stream_iterate),
+	}
+};
+
+static value_t Chunk_stream_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Chunk_stream_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t Stream_done_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	return ThrowCStr( zone, "the iterator is not valid" );
+}
+
+static value_t Stream_done_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	return ThrowCStr( zone, "the iterator is not valid" );
+}
+
+static const struct method_table Stream_done_methods = {
+	(function_t)Stream_done_function,
+	{
+		METHOD_ENTRY(current, Stream_done_current),
+		METHOD_ENTRY(next, Stream_done_next),
+		METHOD_CLOSURE(is_valid, &False_returner),
+	}
+};
+
+static value_t Stream_done_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Stream_done_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t IOAction_ReadChunks_2( PREFUNC, value_t action )
+{
+	assert( IsAnIOAction( action ) );
+	value_t file = action->slots[ IOACTION_SLOT_COUNT + 0 ];
+	value_t size = action->slots[ IOACTION_SLOT_COUNT + 1 ];
+	if (!IsAFixint( size ) || IntFromFixint( size ) <= 0) {
+		return ThrowCStr( zone, "chunk size must be a positive integer" );
+	}
+	if (IsAnException( file )) return ThrowCStr( zone, "failed to open file" );
+	const char *cpath = UnpackString( zone, file );
+	if (!cpath) return ThrowCStr( zone, "failed to open file" );
+
+	// Make sure the file can be opened now, rather than failing halfway
+	// through the loop which consumes the stream, and get the kernel started
+	// on the first chunk.
+	int fd = open( cpath, O_RDONLY );
+	if (fd < 0) {
+		free( (void*)cpath );
+		return ThrowCStr( zone, "failed to open file" );
+	}
+	posix_fadvise( fd, 0, IntFromFixint( size ), POSIX_FADV_WILLNEED );
+	close( fd );
+
+	size_t length = strlen( cpath ) + 1;
+	struct buffer *path = Buffer( zone, length );
+	memcpy( path->bytes, cpath, length );
+	free( (void*)cpath );
+	struct closure *out =
+			ALLOC( Chunk_stream_function, CHUNK_STREAM_SLOT_COUNT );
+	out->slots[CHUNK_STREAM_PATH_SLOT] = (value_t)path;
+	out->slots[CHUNK_STREAM_SIZE_SLOT] = size;
+	return out;
+}
+
+static value_t Read_Chunks_function( PREFUNC, value_t path, value_t size )
+{
+	ARGCHECK_2( path, size );
+	static struct closure proc = {(function_t)IOAction_ReadChunks_2};
+	return MakeAsyncIOAction_2( zone, &proc, path, size );
+}
+
+const struct closure Read_Chunks = {(function_t)Read_Chunks_function};
+
+static value_t MakeLineIterator(
+		zone_t zone,
+		value_t line,
+		value_t chunk,
+		size_t offset,
+		value_t chunks,
+		bool skip_lf )
+{
+	struct closure *out =
+			ALLOC( Line_iterator_function, LINE_ITERATOR_SLOT_COUNT );
+	out->slots[LINE_ITERATOR_LINE_SLOT] = line;
+	out->slots[LINE_ITERATOR_CHUNK_SLOT] = chunk;
+	out->slots[LINE_ITERATOR_OFFSET_SLOT] = NumberFromInt( zone, offset );
+	out->slots[LINE_ITERATOR_CHUNKS_SLOT] = chunks;
+	out->slots[LINE_ITERATOR_SKIP_LF_SLOT] = BooleanFromBool( skip_lf );
+	return out;
+}
+
+static const byte_t *FindLinebreak( const byte_t *bytes, size_t length )
+{
+	// Look for the first LF, then for any CR ahead of it; memchr scans a
+	// block at a time, which a loop testing each byte for both cannot.
+	const byte_t *lf = memchr( bytes, '\n', length );
+	size_t before = lf ? (size_t)(lf - bytes) : length;
+	const byte_t *cr = memchr( bytes, '\r', before );
+	return cr ? cr : lf;
+}
+
+static value_t FindLine(
+		zone_t zone,
+		value_t chunk,
+		size_t offset,
+		value_t chunks,
+		bool skip_lf )
+{
+	// Find the next line, starting at this offset in the current chunk and
+	// moving on to later chunks as necessary. The linebreak conventions are
+	// the same as for string.split_lines: LF, CR, or CR-LF, and a break at
+	// the very end does not produce an extra empty line. A line which begins
+	// in one chunk and ends in another has to be copied; others are views.
+	struct byte_sink carry = {NULL, 0, 0};
+	bool carrying = false;
+	while (true) {
+		const byte_t *bytes = NULL;
+		size_t length = 0;
+		if (!BufferBytes( chunk, &bytes, &length ) || offset >= length) {
+			if (IsAnException( chunks )) {
+				free( carry.data );
+				return chunks;
+			}
+			value_t is_valid = METHOD_0( chunks, sym_is_valid );
+			if (IsAnException( is_valid )) {
+				free( carry.data );
+				return is_valid;
+			}
+			if (!BoolFromBoolean( zone, is_valid )) break;
+			value_t current = METHOD_0( chunks, sym_current );
+			chunk = BufferFromSequence( zone, current );
+			if (IsAnException( chunk )) {
+				free( carry.data );
+				return chunk;
+			}
+			chunks = METHOD_0( chunks, sym_next );
+			offset = 0;
+			continue;
+		}
+		if (skip_lf) {
+			skip_lf = false;
+			if ('\n' == bytes[offset]) {
+				offset++;
+			}
+			continue;
+		}
+		const byte_t *brk = FindLinebreak( &bytes[offset], length - offset );
+		if (!brk) {
+			SinkWrite( &carry, &bytes[offset], length - offset );
+			carrying = true;
+			offset = length;
+			continue;
+		}
+		size_t end = brk - bytes;
+		size_t after = end + 1;
+		if ('\r' == *brk) {
+			if (after == length) {
+				skip_lf = true;
+			} else if ('\n' == bytes[after]) {
+				after++;
+			}
+		}
+		value_t line = NULL;
+		if (carrying) {
+			SinkWrite( &carry, &bytes[offset], end - offset );
+			line = BufferFromSink( zone, &carry );
+		} else {
+			line = BufferView( zone, chunk, offset, end - offset );
+		}
+		return MakeLineIterator( zone, line, chunk, after, chunks, skip_lf );
+	}
+	// We have run out of chunks. Whatever we were carrying is the last line.
+	if (carrying) {
+		value_t line = BufferFromSink( zone, &carry );
+		return MakeLineIterator( zone, line, num_zero, 0, chunks, false );
+	}
+	return &Stream_done;
+}
+
+static value_t Line_iterator_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	return iterator->slots[LINE_ITERATOR_LINE_SLOT];
+}
+
+static value_t Line_iterator_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t skip_lf = iterator->slots[LINE_ITERATOR_SKIP_LF_SLOT];
+	return FindLine(
+			zone,
+			iterator->slots[LINE_ITERATOR_CHUNK_SLOT],
+			IntFromFixint( iterator->slots[LINE_ITERATOR_OFFSET_SLOT] ),
+			iterator->slots[LINE_ITERATOR_CHUNKS_SLOT],
+			BoolFromBoolean( zone, skip_lf ) );
+}
+
+static const struct method_table Line_iterator_methods = {
+	(function_t)Line_iterator_function,
+	{
+		METHOD_ENTRY(current, Line_iterator_current),
+		METHOD_ENTRY(next, Line_iterator_next),
+		METHOD_CLOSURE(is_valid, &True_returner),
+	}
+};
+
+static value_t Line_iterator_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Line_iterator_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t Line_stream_iterate( PREFUNC, value_t stream )
+{
+	ARGCHECK_1( stream );
+	value_t chunks = stream->slots[LINE_STREAM_CHUNKS_SLOT];
+	value_t iter = METHOD_0( chunks, sym_iterate );
+	if (IsAnException( iter )) return iter;
+	return FindLine( zone, num_zero, 0, iter, false );
+}
+
+static const struct method_table Line_stream_methods = {
+	(function_t)Line_stream_function,
+	{
+		METHOD_ENTRY(iterate, Line_stream_iterate),
+	}
+};
+
+static value_t Line_stream_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Line_stream_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t byte_lines_function( PREFUNC, value_t chunks )
+{
+	ARGCHECK_1( chunks );
+	struct closure *out = ALLOC( Line_stream_function, LINE_STREAM_SLOT_COUNT );
+	out->slots[LINE_STREAM_CHUNKS_SLOT] = chunks;
+	return out;
+}
+const struct closure byte_lines = {(function_t)byte_lines_function};
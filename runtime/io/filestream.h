@@ -0,0 +1,35 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef filestream_h
+#define filestream_h
+
+#include "../closures.h"
+
+// Builtin entrypoints for reading a file without holding all of it in memory.
+// Read_Chunks is an IO action which responds with a lazy sequence of byte
+// buffers, read from the file as the sequence is iterated. byte_lines splits
+// any sequence of byte chunks into a lazy sequence of lines; a line which
+// lies within one chunk is a view of that chunk rather than a copy.
+extern const struct closure Read_Chunks;
+extern const struct closure byte_lines;
+
+#endif //filestream_h
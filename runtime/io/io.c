@@ -130,9 +130,13 @@ int RunIO( value_t proc, value_t argument )
 		task = METHOD_1( task, sym_send, result );
 		// Release any temporary data we allocated while producing that action.
 		// This will move the task on to the next zone. We will start the next
-		// loop iteration with a fresh scratch zone.
+		// loop iteration with a fresh scratch zone. Workers may be running
+		// one of the task's generators ahead, so they must stay out of the
+		// way while we do this.
 		zone_t next = zone_create();
+		parallel_quiesce( zone );
 		task = collect_zone( zone, task, next );
+		parallel_resume();
 		zone = next;
 	}
 
@@ -34,8 +34,10 @@ zone_t init_runtime(void)
 	init_numbers( global_zone );
 	init_symbols( global_zone );
 	init_parallel();
+	init_basicio();
 #if RUN_TESTS
 	test_numbers( global_zone );
+	test_buffers( global_zone );
 #endif
 	return global_zone;
 }
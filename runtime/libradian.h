@@ -30,6 +30,11 @@
 #include "atoms/booleans.h"
 #include "atoms/relations.h"
 #include "atoms/stringliterals.h"
+#include "stringsearch.h"
+#include "ranges.h"
+#include "sequences.h"
+#include "encodings.h"
+#include "casemapping.h"
 #include "atoms/symbols.h"
 #include "atoms/floats.h"
 #include "io/io.h"
@@ -37,8 +42,10 @@
 #include "io/callout.h"
 #include "io/loadexternal.h"
 #include "io/basicio.h"
+#include "io/filestream.h"
 #include "containers/tuples.h"
 #include "containers/maps.h"
+#include "containers/records.h"
 #include "containers/lists.h"
 #include "containers/list-empty.h"
 #include "flowcontrol.h"
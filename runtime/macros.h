@@ -45,13 +45,22 @@
 	alloc_buffer(zone, (function_t)function, bytes)
 
 
-// These macros simplify the process of calling an invokable from C code.
+// These macros simplify the process of calling an invokable from C code. Each
+// one calls through the fixed-arity function type for its argument count; see
+// closures.h.
+#define CALL_0(target) \
+	((function0_t)(target)->function)(zone,(target),0)
 #define CALL_1(target, arg0) \
-	target->function(zone,(target),1,(arg0))
+	((function1_t)(target)->function)(zone,(target),1,(arg0))
 #define CALL_2(target, arg0, arg1) \
-	target->function(zone,(target),2,(arg0),(arg1))
+	((function2_t)(target)->function)(zone,(target),2,(arg0),(arg1))
 #define CALL_3(target, arg0, arg1, arg2) \
-	target->function(zone,(target),3,(arg0),(arg1),(arg2))
+	((function3_t)(target)->function)(zone,(target),3,(arg0),(arg1),(arg2))
+#define CALL_4(target, arg0, arg1, arg2, arg3) \
+	((function4_t)(target)->function)( \
+			zone,(target),4,(arg0),(arg1),(arg2),(arg3))
+#define CALL_SPILL(target, count, args) \
+	((function_spill_t)(target)->function)(zone,(target),(count),(args))
 
 
 // An object is an invokable which accepts one parameter: a symbol identifying
@@ -65,7 +74,9 @@
 	method_2(zone, (target), (sym), (arg0), (arg1))
 
 
-// When defining an object dispatcher function, this may be convenient:
+// When defining an object dispatcher function, this may be convenient. Types
+// whose methods are called often should use a method table instead, which
+// also lets METHOD_n skip the dispatcher call; see dispatch.h.
 #define DEFINE_METHOD(name, function) \
 	if (sym_##name == selector) { \
 		static struct closure out = {(function_t)function}; \
@@ -98,5 +109,12 @@
 	if (IsAnException(arg0)) return (arg0); \
 	if (IsAnException(arg1)) return (arg1); \
 	if (IsAnException(arg2)) return (arg2);
+#define ARGCHECK_4(arg0, arg1, arg2, arg3) \
+	if (TRACE) fprintf( stderr, "%s\n", __func__ ); \
+	if (argc != 4) return ThrowArgCountFail( zone, __func__, 4, argc ); \
+	if (IsAnException(arg0)) return (arg0); \
+	if (IsAnException(arg1)) return (arg1); \
+	if (IsAnException(arg2)) return (arg2); \
+	if (IsAnException(arg3)) return (arg3);
 
 #endif	//macros_h
@@ -112,6 +112,49 @@ void zone_destroy( zone_t zone )
 	page_free( zone );
 }
 
+static size_t overflow_footprint( group_t overflow )
+{
+	// Each overflow group is a page full of pointers to large blocks.
+	size_t total = 0;
+	while (overflow) {
+		total += PAGE_SIZE;
+		large_block_t *end = (large_block_t*)((char*)overflow + PAGE_SIZE);
+		char *begin =
+				(char*)overflow + sizeof(struct group) + overflow->available;
+		large_block_t *target = (large_block_t*)begin;
+		while (target < end) {
+			total += sizeof(struct large_block);
+			total += (*target)->header.element_size;
+			target++;
+		}
+		overflow = overflow->previous;
+	}
+	return total;
+}
+
+size_t zone_footprint( zone_t zone )
+{
+	// Add up the pages this zone is holding, following the same structure
+	// zone_destroy walks when it gives them back: the master index page, the
+	// small block groups, and the large blocks.
+	thread_mutex_lock( &zone->lock );
+	size_t total = PAGE_SIZE;
+	unsigned int group_count = PAGE_SIZE / sizeof(void*) / 2;
+	for (unsigned int i = 0; i < group_count; i++) {
+		for (group_t group = zone->small_blocks[i]; group; ) {
+			total += PAGE_SIZE;
+			group = group->previous;
+		}
+	}
+	large_block_t *end = (large_block_t*)zone->small_blocks;
+	for (large_block_t *target = zone->large_blocks; target < end; target++) {
+		total += sizeof(struct large_block) + (*target)->header.element_size;
+	}
+	total += overflow_footprint( zone->overflow );
+	thread_mutex_unlock( &zone->lock );
+	return total;
+}
+
 static void *large_alloc( zone_t zone, size_t size )
 {
 	// First, ask the system VM for a set of pages large enough to hold the
@@ -30,4 +30,7 @@ zone_t zone_create(void);
 void zone_destroy(zone_t zone);
 void *zone_alloc(zone_t zone, size_t size);
 
+// How many bytes of memory has this zone taken from the VM?
+size_t zone_footprint(zone_t zone);
+
 #endif	//allocator_h
@@ -60,26 +60,61 @@
 #include "exceptions.h"
 #include "symbols.h"
 #include "booleans.h"
+#include "numbers.h"
+#include "rationals.h"
+#include "stringliterals.h"
+#include "sequences.h"
+#include "containers/tuples.h"
+#include "buffer.h"
+#include "collector.h"
 #include "platform/threads.h"
+#include "platform/pagealloc.h"
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
+#include <time.h>
 #include "macros.h"
 
+// Each wrapper iterator stands for a block of consecutive elements from the
+// source sequence, which one thread computes as a single task; this way the
+// cost of handing work from one thread to another is spread across the whole
+// block. The consumer walks through the finished block as a batch, without
+// touching any shared state, and only comes back to the wrapper chain at the
+// next block. The final wrapper in the chain has an empty block.
+
 // iterator object slots
-//	0: wrapped iterator
+//	0: wrapped iterator, or index of the block's first element
 //	1: calculated "is_valid" value
-//	2: calculated "current" value
+//	2: calculated element values, as a tuple
 //	3: calculated "next" value (this is a wrapper)
-#define ITERATOR_SLOT_COUNT 4
+//	4: claim marker, set by whichever thread processes the iterator
+//	5: handover record, a buffer holding a struct handover
+//	6: timing statistics for the loop, a buffer holding a struct loop_stats
+//	7: random-access sequence the loop is splitting by index, if any
+//	8: size of the random-access sequence
+#define ITERATOR_SLOT_COUNT 9
 #define ITERATOR_WRAPPED_SLOT 0
 #define ITERATOR_VALID_SLOT 1
-#define ITERATOR_CURRENT_SLOT 2
+#define ITERATOR_ITEMS_SLOT 2
 #define ITERATOR_NEXT_SLOT 3
-static value_t wrap_source_iterator( zone_t zone, value_t original );
+#define ITERATOR_CLAIM_SLOT 4
+#define ITERATOR_HANDOVER_SLOT 5
+#define ITERATOR_STATS_SLOT 6
+#define ITERATOR_SEQUENCE_SLOT 7
+#define ITERATOR_SIZE_SLOT 8
+static value_t wrap_source_iterator(
+		zone_t zone, value_t original, value_t stats );
+static value_t wrap_index_range(
+		zone_t zone, value_t seq, size_t index, value_t size, value_t stats );
 static void *worker_main( void *arg );
+static value_t pariter( PREFUNC, value_t selector );
+static bool is_work_claimed( value_t task );
+static value_t future( PREFUNC );
+static void run_future( zone_t zone, value_t task, bool detached );
 
 // an iterator can be in three states:
 // not started yet
@@ -87,64 +122,582 @@ static void *worker_main( void *arg );
 // all finished
 // the iterator is kind of a future.
 
+// Each worker owns a work-stealing deque of tasks waiting to be processed, as
+// described by Chase and Lev; most tasks are iterators, and the rest are
+// futures. The owner pushes and pops at the bottom; any other thread may steal
+// from the top. Threads which are not workers, such as the one running the
+// program's main task, share one more deque, and take turns at its bottom
+// under a lock. The deques do not grow: if one is full, the task simply is not
+// queued, and the master will get to it when it walks down the chain, or joins
+// the future. The same goes for tasks beyond the queue limit, which keeps the
+// workers from racing arbitrarily far ahead of the master.
+#define DEQUE_CAPACITY 256
+#define QUEUE_LIMIT_PER_WORKER 2
+struct work {
+	value_t task;
+	zone_t zone;            // the results should end up here
+};
+struct deque {
+	long top;
+	long bottom;
+	struct work items[DEQUE_CAPACITY];
+};
+
+// Workers compute each block of element values in a private zone of their
+// own, so that they do not all contend for the lock on the consumer's zone.
+// When the consumer asks for the block, we collect it back into the
+// consumer's zone; collection destroys the private zone, so the worker starts
+// its next task in a fresh one. Everything else - the validity flag and the
+// next iterator - is cheap, and is allocated directly in the zone of whoever
+// offered the iterator, since other threads will go on to use it. A block the
+// consumer never asks for, because it left the loop early, keeps its private
+// zone alive for the life of the program, or until the IO loop next collects.
+// Until the consumer takes it, each block with a private zone is on a list of
+// pending blocks, so parallel_quiesce() can find it. A worker never starts a
+// parallel loop inside its private zone, so every wrapper, queued task, and
+// pending block lives in some zone which outlasts the worker's computation.
+struct handover {
+	zone_t results;         // private zone holding the items, if any
+	value_t owner;          // the wrapper iterator, while the block is pending
+	struct handover *prev;  // neighbours on the pending list
+	struct handover *next;
+	bool offered;           // has this iterator been queued for the workers?
+	bool taken;             // has the consumer asked for its values yet?
+	bool listed;            // is the block on the pending list?
+	size_t items;           // how many elements the block holds
+	size_t bytes;           // how much memory the private zone holds
+};
+
+// We decide how many cores to put to work on a loop by timing it, following
+// the strategy laid out above. Every thread which computes an element value
+// records how long the map stage took, counting the time it spent stepping
+// the source iterator, since a generator does all of its work when it moves
+// on to the next element; the consumer records the time it spent
+// in the reduce stage, between taking one element and asking for the next.
+// If it takes M to map an element and R to reduce it, then M / R mapping
+// cores will keep the reducer busy, and more would only run ahead. We express
+// that as a limit on how many iterators may be in flight beyond the one the
+// consumer is using. Until we have a few samples, we assume the loop is worth
+// every core we have. If mapping an element costs less than handing it to
+// another thread, we stop queueing iterators at all, and the consumer simply
+// computes each element itself when it asks for it. The averages are updated
+// without locks; a lost sample here and there does no harm.
+// The same measurements size the blocks. We want each block to take long
+// enough that handing it to another thread costs little by comparison, but
+// no longer, so that the workers still have plenty of blocks to share out.
+#define WARMUP_SAMPLES 8
+#define CHEAP_MAP_NS 2000
+#define LOOKAHEAD_PER_CORE 2
+#define WARMUP_BLOCK_SIZE 4
+#define BLOCK_TARGET_NS 20000
+
+// However many cores are working on a loop, a fast producer must not get
+// arbitrarily far ahead of a slow consumer, or it will fill memory with
+// results nobody has asked for yet. Each parallel sequence has a window: the
+// most elements, and the most bytes of private zone memory, which may be
+// computed and waiting for the consumer at once. When the window is full we
+// stop queueing blocks, and the workers go idle until the consumer catches
+// up. The defaults can be changed through the environment variables
+// RADIAN_LOOKAHEAD_ITEMS and RADIAN_LOOKAHEAD_BYTES; the sequence takes its
+// window from them when it is created. We count the times each side of a loop
+// has to stall for the other, and print the counts at exit if the variable
+// RADIAN_PARALLEL_STATS is set.
+#define DEFAULT_WINDOW_ITEMS 4096
+#define DEFAULT_WINDOW_BYTES (64 * 1024 * 1024)
+static uint64_t s_window_items = DEFAULT_WINDOW_ITEMS;
+static uint64_t s_window_bytes = DEFAULT_WINDOW_BYTES;
+static struct parallel_counters s_counters;
+
+struct loop_stats {
+	uint64_t map_ns;        // moving average time to compute an element
+	uint64_t reduce_ns;     // moving average time to consume an element
+	uint64_t last_taken;    // when the consumer last finished taking a block
+	uint64_t last_count;    // how many elements that block contained
+	uint64_t created;       // number of iterators created
+	uint64_t consumed;      // number of iterators taken by the consumer
+	uint64_t window_items;  // most elements which may be waiting
+	uint64_t window_bytes;  // most private zone bytes which may be waiting
+	uint64_t ahead_items;   // elements computed but not yet taken
+	uint64_t ahead_bytes;   // private zone bytes computed but not yet taken
+	unsigned int samples;   // number of blocks timed so far
+	value_t reducer;        // selector folding each block, if any
+};
+
+// Idle threads spin for a little while before parking, since new work tends
+// to show up right after old work finishes. Workers park on the work epoch,
+// which changes whenever someone queues a task; a master waiting on a result
+// parks on the done epoch, which changes whenever a task finishes.
+#define SPIN_LIMIT 200
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_RELAX() __builtin_ia32_pause()
+#else
+#define CPU_RELAX() __asm__ __volatile__( "" ::: "memory" )
+#endif
+
 static unsigned int s_num_workers;
 struct worker {
-	volatile value_t task; // null if no current task
+	struct deque queue;
 	thread_t thread;
-	thread_mutex_t lock;    // protects the "task" variable
-	zone_t zone;            // the results should end up here
+	const unsigned int *procs;  // processors to pin the worker to, if any
+	unsigned int proc_count;
+	int node;                   // NUMA node its zones' memory comes from
 };
 typedef struct worker worker_t;
 static worker_t *s_workers;
+static __thread zone_t s_private;     // private zone we are computing in
+static struct deque s_shared_queue;
+static thread_mutex_t s_shared_lock;
+static __thread worker_t *s_self;
+static long s_queued;
+static unsigned int s_work_epoch;
+static unsigned int s_done_epoch;
+static unsigned int s_idle_workers;
+static unsigned int s_waiting_masters;
+
+// A loop which yields is a generator, and its consumer may walk it across
+// many IO actions, so workers may still be running a generator ahead while the
+// IO loop collects the zone holding the program's working data. The IO loop
+// quiesces the workers around each collection: they finish the tasks they are
+// running, and leave everything else alone until the collection is done.
+static unsigned int s_paused;
+static unsigned int s_active;
+static struct handover *s_pending;
+static thread_mutex_t s_pending_lock;
+
+// By default we start one worker for each processor the process may use, less
+// one for the thread running the program, and let the system schedule them.
+// When the process shares its machine, as in a container, that may not be
+// what anyone wants, so the worker count can be set, and the workers pinned:
+// either one to a processor, with the program's own thread pinned to the
+// first, which caps the workers at one fewer than the processors; or dealt
+// out among the NUMA nodes in turn, free to move within their node.
+// Binding to a node keeps every worker there. Each worker asks for the memory
+// of the node it is pinned to, so the private zones it computes in are local.
+// The settings come from configure_parallel(), or from the environment
+// variables RADIAN_WORKERS, RADIAN_PIN ("none", "core", or "node") and
+// RADIAN_NUMA_NODE, which take precedence.
+#define MAX_PROCS 1024
+static struct parallel_config s_config = {-1, PIN_NONE, -1};
+static unsigned int s_procs[MAX_PROCS];    // sorted by NUMA node
+static int s_proc_nodes[MAX_PROCS];        // the node each one belongs to
+static unsigned int s_proc_count;
+
+static uint64_t window_setting( const char *name, uint64_t fallback )
+{
+	const char *text = getenv( name );
+	if (!text) return fallback;
+	char *end = NULL;
+	unsigned long long value = strtoull( text, &end, 10 );
+	return (end != text && value > 0) ? value : fallback;
+}
+
+static int count_setting( const char *name, int fallback )
+{
+	const char *text = getenv( name );
+	if (!text) return fallback;
+	char *end = NULL;
+	long value = strtol( text, &end, 10 );
+	return (end != text && value >= 0 && value <= INT_MAX) ?
+			(int)value : fallback;
+}
+
+static enum parallel_pinning pin_setting(
+		const char *name, enum parallel_pinning fallback )
+{
+	const char *text = getenv( name );
+	if (!text) return fallback;
+	if (0 == strcmp( text, "none" )) return PIN_NONE;
+	if (0 == strcmp( text, "core" )) return PIN_CORE;
+	if (0 == strcmp( text, "node" )) return PIN_NODE;
+	return fallback;
+}
+
+static void report_counters(void)
+{
+	struct parallel_counters counts;
+	parallel_counters( &counts );
+	fprintf( stderr,
+			"parallel: %llu blocks, %llu producer stalls, "
+			"%llu consumer stalls\n",
+			(unsigned long long)counts.blocks,
+			(unsigned long long)counts.producer_stalls,
+			(unsigned long long)counts.consumer_stalls );
+}
+
+void parallel_counters( struct parallel_counters *out )
+{
+	out->blocks = __atomic_load_n( &s_counters.blocks, __ATOMIC_RELAXED );
+	out->producer_stalls =
+			__atomic_load_n( &s_counters.producer_stalls, __ATOMIC_RELAXED );
+	out->consumer_stalls =
+			__atomic_load_n( &s_counters.consumer_stalls, __ATOMIC_RELAXED );
+}
+
+void configure_parallel( const struct parallel_config *config )
+{
+	s_config = *config;
+}
+
+void parallel_config( struct parallel_config *out )
+{
+	*out = s_config;
+}
+
+static unsigned int find_procs( int node )
+{
+	// List the processors we may use, keeping only those on the given node,
+	// if there is one. Sort them by node, so each node's processors form a
+	// run; there are few enough that an insertion sort will do.
+	unsigned int found = thread_list_procs( s_procs, MAX_PROCS );
+	if (found > MAX_PROCS) found = MAX_PROCS;
+	unsigned int count = 0;
+	for (unsigned int i = 0; i < found; i++) {
+		unsigned int proc = s_procs[i];
+		int key = thread_proc_node( proc );
+		if (node >= 0 && key != node) continue;
+		unsigned int j = count++;
+		for (; j > 0 && s_proc_nodes[j - 1] > key; j--) {
+			s_procs[j] = s_procs[j - 1];
+			s_proc_nodes[j] = s_proc_nodes[j - 1];
+		}
+		s_procs[j] = proc;
+		s_proc_nodes[j] = key;
+	}
+	return count;
+}
+
+static void place_worker( worker_t *it, unsigned int index )
+{
+	// Decide which processors this worker may run on, and whose memory its
+	// zones should come from.
+	it->procs = NULL;
+	it->proc_count = 0;
+	it->node = s_config.numa_node;
+	if (0 == s_proc_count) return;
+	if (PIN_CORE == s_config.pinning) {
+		unsigned int proc = index + 1;
+		assert( proc < s_proc_count );
+		it->procs = &s_procs[proc];
+		it->proc_count = 1;
+		it->node = s_proc_nodes[proc];
+	} else if (PIN_NODE == s_config.pinning) {
+		unsigned int runs = 1;
+		for (unsigned int i = 1; i < s_proc_count; i++) {
+			runs += s_proc_nodes[i] != s_proc_nodes[i - 1];
+		}
+		unsigned int run = index % runs;
+		unsigned int start = 0;
+		while (run > 0) {
+			start++;
+			run -= s_proc_nodes[start] != s_proc_nodes[start - 1];
+		}
+		unsigned int end = start + 1;
+		while (end < s_proc_count &&
+				s_proc_nodes[end] == s_proc_nodes[start]) {
+			end++;
+		}
+		it->procs = &s_procs[start];
+		it->proc_count = end - start;
+		it->node = s_proc_nodes[start];
+	} else if (s_config.numa_node >= 0) {
+		it->procs = s_procs;
+		it->proc_count = s_proc_count;
+	}
+}
 
 void init_parallel(void)
 {
-	// Find out how many cores this machine has.
-	// Allocate N - 1 workers.
+	// Work out how many workers we want, and where they should run. If we
+	// are asked to bind to a node with no processors we may use, we ignore
+	// the request.
+	s_config.workers = count_setting( "RADIAN_WORKERS", s_config.workers );
+	s_config.pinning = pin_setting( "RADIAN_PIN", s_config.pinning );
+	s_config.numa_node =
+			count_setting( "RADIAN_NUMA_NODE", s_config.numa_node );
+	s_proc_count = find_procs( s_config.numa_node );
+	if (0 == s_proc_count && s_config.numa_node >= 0) {
+		s_config.numa_node = -1;
+		s_proc_count = find_procs( -1 );
+	}
 	unsigned int num_cores = thread_count_procs();
 	assert( num_cores > 0 );
-	s_num_workers = num_cores - 1;
+	if (s_config.numa_node >= 0 && s_proc_count < num_cores) {
+		num_cores = s_proc_count;
+	}
+	s_num_workers = s_config.workers >= 0 ?
+			(unsigned int)s_config.workers : num_cores - 1;
+	if (PIN_CORE == s_config.pinning && s_proc_count > 0) {
+		if (s_num_workers > s_proc_count - 1) {
+			s_num_workers = s_proc_count - 1;
+		}
+		thread_pin_self( &s_procs[0], 1 );
+	}
+	s_config.workers = (int)s_num_workers;
+	if (s_config.numa_node >= 0) {
+		page_prefer_node( s_config.numa_node );
+	}
+	thread_mutex_create( &s_shared_lock );
+	thread_mutex_create( &s_pending_lock );
+	s_window_items = window_setting( "RADIAN_LOOKAHEAD_ITEMS", s_window_items );
+	s_window_bytes = window_setting( "RADIAN_LOOKAHEAD_BYTES", s_window_bytes );
+	if (getenv( "RADIAN_PARALLEL_STATS" )) {
+		atexit( report_counters );
+	}
 
 	if (s_num_workers > 0) {
 		s_workers = (worker_t*)calloc( s_num_workers, sizeof(worker_t) );
 		// allocate a pthread for each worker
 		for (unsigned int i = 0; i < s_num_workers; i++) {
 			worker_t *it = &s_workers[i];
-			thread_mutex_create( &it->lock );
+			place_worker( it, i );
 			thread_create( &it->thread, worker_main, it );
 		}
 	}
 }
 
-static void queue_iterator( zone_t zone, value_t task )
-{
-	// Look for an idle worker and try to convince it to get busy prefetching
-	// the values in this iterator. It's OK if we don't succeed; all workers
-	// might already be committed. We don't actually care whether the iterator
-	// gets queued: we just want to make sure all the workers are busy. This
-	// should be as quick a process as we can manage since it is loop overhead.
-	bool assigned = false;
-	for (unsigned int i = 0; i < s_num_workers && !assigned; i++) {
-		// If this worker appears to be idle, try to lock it. Once we've locked
-		// it, check again, in case someone else assigned it a task just before
-		// we acquired the lock. If the worker is still idle, give it our task.
-		if (s_workers[i].task) continue;
-		if (thread_mutex_trylock( &s_workers[i].lock )) continue;
-		// we've locked the worker: now we have a chance to assign it our task.
-		// If nobody else assigned it a task while we were taking out the lock,
-		// we'll do so now.
-		if (NULL == s_workers[i].task) {
-			// The worker thread itself does not block on its own mutex when
-			// checking the state of its task variable. Assigning a non-null
-			// value to the task variable must be the last thing we do, since
-			// that will unblock the worker, and it will expect to have a zone
-			// to do allocation in.
-			s_workers[i].zone = zone;
-			s_workers[i].task = task;
-			assigned = true;
+static bool deque_push( struct deque *q, value_t task, zone_t zone )
+{
+	long b = __atomic_load_n( &q->bottom, __ATOMIC_RELAXED );
+	long t = __atomic_load_n( &q->top, __ATOMIC_ACQUIRE );
+	if (b - t >= DEQUE_CAPACITY) return false;
+	struct work *slot = &q->items[b % DEQUE_CAPACITY];
+	__atomic_store_n( &slot->task, task, __ATOMIC_RELAXED );
+	__atomic_store_n( &slot->zone, zone, __ATOMIC_RELAXED );
+	__atomic_store_n( &q->bottom, b + 1, __ATOMIC_RELEASE );
+	return true;
+}
+
+static bool deque_pop( struct deque *q, struct work *out )
+{
+	long b = __atomic_load_n( &q->bottom, __ATOMIC_RELAXED ) - 1;
+	__atomic_store_n( &q->bottom, b, __ATOMIC_RELAXED );
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+	long t = __atomic_load_n( &q->top, __ATOMIC_RELAXED );
+	if (t > b) {
+		__atomic_store_n( &q->bottom, b + 1, __ATOMIC_RELAXED );
+		return false;
+	}
+	struct work *slot = &q->items[b % DEQUE_CAPACITY];
+	out->task = __atomic_load_n( &slot->task, __ATOMIC_RELAXED );
+	out->zone = __atomic_load_n( &slot->zone, __ATOMIC_RELAXED );
+	if (t < b) return true;
+	// This was the last item, so we are racing the thieves for it.
+	bool won = __atomic_compare_exchange_n(
+			&q->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED );
+	__atomic_store_n( &q->bottom, b + 1, __ATOMIC_RELAXED );
+	return won;
+}
+
+static bool deque_steal( struct deque *q, struct work *out )
+{
+	long t = __atomic_load_n( &q->top, __ATOMIC_ACQUIRE );
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+	long b = __atomic_load_n( &q->bottom, __ATOMIC_ACQUIRE );
+	if (t >= b) return false;
+	// The owner cannot overwrite this slot until the top has moved past it,
+	// in which case our exchange fails and we throw away what we read.
+	struct work *slot = &q->items[t % DEQUE_CAPACITY];
+	out->task = __atomic_load_n( &slot->task, __ATOMIC_RELAXED );
+	out->zone = __atomic_load_n( &slot->zone, __ATOMIC_RELAXED );
+	return __atomic_compare_exchange_n(
+			&q->top, &t, t + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED );
+}
+
+static bool take_work( struct work *out )
+{
+	// Look for a queued task: first at the bottom of our own deque, where the
+	// most recently queued work is, then at the top of everyone else's.
+	if (s_self && deque_pop( &s_self->queue, out )) return true;
+	unsigned int start = s_self ? (unsigned int)(s_self - s_workers) + 1 : 0;
+	for (unsigned int i = 0; i < s_num_workers; i++) {
+		worker_t *victim = &s_workers[(start + i) % s_num_workers];
+		if (victim != s_self && deque_steal( &victim->queue, out )) {
+			return true;
+		}
+	}
+	return deque_steal( &s_shared_queue, out );
+}
+
+static void add_pending( struct handover *handover )
+{
+	thread_mutex_lock( &s_pending_lock );
+	handover->prev = NULL;
+	handover->next = s_pending;
+	if (s_pending) {
+		s_pending->prev = handover;
+	}
+	s_pending = handover;
+	handover->listed = true;
+	thread_mutex_unlock( &s_pending_lock );
+}
+
+static void unlink_pending( struct handover *handover )
+{
+	// The caller holds the pending lock. The block may already be gone from
+	// the list, if parallel_quiesce() took it first.
+	if (!handover->listed) return;
+	if (handover->prev) {
+		handover->prev->next = handover->next;
+	} else {
+		s_pending = handover->next;
+	}
+	if (handover->next) {
+		handover->next->prev = handover->prev;
+	}
+	handover->prev = NULL;
+	handover->next = NULL;
+	handover->listed = false;
+}
+
+static void remove_pending( struct handover *handover )
+{
+	thread_mutex_lock( &s_pending_lock );
+	unlink_pending( handover );
+	thread_mutex_unlock( &s_pending_lock );
+}
+
+void parallel_quiesce( zone_t zone )
+{
+	// Wait for the workers to finish whatever they are running, then forget
+	// the iterators waiting in the queues, since they live in the zone which
+	// is about to move. Nothing is lost: the consumer computes any block
+	// nobody has started when it gets there, and clearing the offered flag
+	// lets it hand the block back to the workers once they are running again.
+	// An iterator some thread has already claimed stays offered, so it is
+	// never queued twice. Once the workers have stopped, every queued task
+	// lives in a zone which outlasts them: futures spawned in a private zone
+	// were joined before the worker finished, and loops never start there.
+	// Finally, bring every pending block into the zone, since its elements
+	// may refer to objects there, and the collector does not look inside
+	// private zones to find those references. A consumer may be taking a
+	// block at the same time; whichever of us gets its private zone first
+	// collects it.
+	if (s_num_workers == 0) return;
+	__atomic_store_n( &s_paused, 1, __ATOMIC_SEQ_CST );
+	while (__atomic_load_n( &s_active, __ATOMIC_SEQ_CST )) {
+		CPU_RELAX();
+	}
+	struct work work;
+	while (take_work( &work )) {
+		__atomic_sub_fetch( &s_queued, 1, __ATOMIC_SEQ_CST );
+		if (work.task->function != (function_t)pariter) continue;
+		if (is_work_claimed( work.task )) continue;
+		value_t record = work.task->slots[ITERATOR_HANDOVER_SLOT];
+		struct handover *handover = BUFDATA( record, struct handover );
+		__atomic_store_n( &handover->offered, false, __ATOMIC_RELAXED );
+	}
+	thread_mutex_lock( &s_pending_lock );
+	while (s_pending) {
+		struct handover *it = s_pending;
+		zone_t results =
+				__atomic_exchange_n( &it->results, NULL, __ATOMIC_ACQ_REL );
+		if (results) {
+			value_t *items = &CLOSURE(it->owner)->slots[ITERATOR_ITEMS_SLOT];
+			*items = collect_zone( results, *items, zone );
 		}
-		assert( 0 == thread_mutex_unlock( &s_workers[i].lock ) );
+		unlink_pending( it );
+	}
+	thread_mutex_unlock( &s_pending_lock );
+}
+
+void parallel_resume(void)
+{
+	__atomic_store_n( &s_paused, 0, __ATOMIC_SEQ_CST );
+}
+
+static bool queue_task( zone_t zone, value_t task )
+{
+	// Offer this task to the workers, so that one of them can get busy on it.
+	// It's OK if we don't succeed; it is more important that this be quick,
+	// since it is loop overhead.
+	long queued = __atomic_load_n( &s_queued, __ATOMIC_RELAXED );
+	if (queued >= (long)(s_num_workers * QUEUE_LIMIT_PER_WORKER)) return false;
+	bool pushed = false;
+	if (s_self) {
+		pushed = deque_push( &s_self->queue, task, zone );
+	} else {
+		thread_mutex_lock( &s_shared_lock );
+		pushed = deque_push( &s_shared_queue, task, zone );
+		thread_mutex_unlock( &s_shared_lock );
+	}
+	if (!pushed) return false;
+	__atomic_add_fetch( &s_queued, 1, __ATOMIC_SEQ_CST );
+	__atomic_add_fetch( &s_work_epoch, 1, __ATOMIC_SEQ_CST );
+	if (__atomic_load_n( &s_idle_workers, __ATOMIC_SEQ_CST )) {
+		thread_unpark( &s_work_epoch, 1 );
 	}
+	return true;
+}
+
+static uint64_t clock_ns(void)
+{
+	struct timespec now;
+	clock_gettime( CLOCK_MONOTONIC, &now );
+	return (uint64_t)now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+static void record_sample( uint64_t *average, uint64_t sample )
+{
+	// Exponential moving average, weighting the newest sample by 1/8.
+	uint64_t old = __atomic_load_n( average, __ATOMIC_RELAXED );
+	uint64_t updated = old ? old - old / 8 + sample / 8 : sample;
+	__atomic_store_n( average, updated, __ATOMIC_RELAXED );
+}
+
+static size_t block_size( struct loop_stats *stats )
+{
+	// How many elements should go into each block?
+	if (__atomic_load_n( &stats->samples, __ATOMIC_RELAXED ) < WARMUP_SAMPLES) {
+		return WARMUP_BLOCK_SIZE;
+	}
+	uint64_t map = __atomic_load_n( &stats->map_ns, __ATOMIC_RELAXED );
+	uint64_t size = BLOCK_TARGET_NS / (map ? map : 1);
+	if (size > stats->window_items) {
+		size = stats->window_items;
+	}
+	if (size < 1) return 1;
+	return size < BATCH_LIMIT ? (size_t)size : BATCH_LIMIT;
+}
+
+static unsigned int mapping_cores( struct loop_stats *stats )
+{
+	// How many workers should be computing blocks for this loop?
+	if (__atomic_load_n( &stats->samples, __ATOMIC_RELAXED ) < WARMUP_SAMPLES) {
+		return s_num_workers;
+	}
+	uint64_t map = __atomic_load_n( &stats->map_ns, __ATOMIC_RELAXED );
+	if (map * block_size( stats ) < CHEAP_MAP_NS) return 0;
+	uint64_t reduce = __atomic_load_n( &stats->reduce_ns, __ATOMIC_RELAXED );
+	if (reduce == 0) reduce = 1;
+	uint64_t cores = (map + reduce - 1) / reduce;
+	return cores < s_num_workers ? (unsigned int)cores : s_num_workers;
+}
+
+static void offer_iterator( zone_t zone, value_t task )
+{
+	// Queue this iterator for the workers, if the loop is running far enough
+	// behind that it needs the help, and nobody has already done so.
+	struct loop_stats *stats =
+			BUFDATA( task->slots[ITERATOR_STATS_SLOT], struct loop_stats );
+	struct handover *handover =
+			BUFDATA( task->slots[ITERATOR_HANDOVER_SLOT], struct handover );
+	uint64_t created = __atomic_load_n( &stats->created, __ATOMIC_RELAXED );
+	uint64_t consumed = __atomic_load_n( &stats->consumed, __ATOMIC_RELAXED );
+	uint64_t depth = mapping_cores( stats ) * LOOKAHEAD_PER_CORE;
+	if (created - consumed > depth) return;
+	// If the window is already full of results, the worker which would have
+	// picked this block up will have to wait for the consumer instead.
+	uint64_t items = __atomic_load_n( &stats->ahead_items, __ATOMIC_RELAXED );
+	uint64_t bytes = __atomic_load_n( &stats->ahead_bytes, __ATOMIC_RELAXED );
+	if (items >= stats->window_items || bytes >= stats->window_bytes) {
+		__atomic_add_fetch(
+				&s_counters.producer_stalls, 1, __ATOMIC_RELAXED );
+		return;
+	}
+	if (__atomic_exchange_n( &handover->offered, true, __ATOMIC_RELAXED )) {
+		return;
+	}
+	queue_task( zone, task );
 }
 
 static bool is_work_finished( value_t task )
@@ -153,16 +706,84 @@ static bool is_work_finished( value_t task )
 	// its wrapped iterator is gone. We need the original data only until we
 	// have finished flattening the wrapper; then the wrapper contains all the
 	// result data.
-	return (NULL == task->slots[0]);
+	return NULL == __atomic_load_n(
+			&task->slots[ITERATOR_WRAPPED_SLOT], __ATOMIC_ACQUIRE );
 }
 
-static bool is_work_in_progress( value_t wrapper )
+static bool is_work_claimed( value_t task )
 {
-	// Is one of our workers currently digging away at this iterator?
-	for (unsigned int i = 0; i < s_num_workers; i++) {
-		if (s_workers[i].task == wrapper) return true;
+	// Has some thread already started on this iterator?
+	return NULL != __atomic_load_n(
+			&task->slots[ITERATOR_CLAIM_SLOT], __ATOMIC_ACQUIRE );
+}
+
+static value_t next_in_chain( value_t task )
+{
+	// The wrapper following this one, if it has been created yet. A source
+	// iterator which fails leaves an exception in its place, which ends the
+	// chain as far as the scheduler is concerned.
+	value_t next = __atomic_load_n(
+			&task->slots[ITERATOR_NEXT_SLOT], __ATOMIC_ACQUIRE );
+	return (next && next->function == (function_t)pariter) ? next : NULL;
+}
+
+static bool claim_work( value_t task )
+{
+	// An iterator may be reached both through a deque and by walking down the
+	// chain, so the threads which find it race to claim it; only the winner
+	// processes it.
+	value_t expected = NULL;
+	return __atomic_compare_exchange_n(
+			&CLOSURE(task)->slots[ITERATOR_CLAIM_SLOT],
+			&expected,
+			&True_returner,
+			false,
+			__ATOMIC_ACQ_REL,
+			__ATOMIC_RELAXED );
+}
+
+static void announce_done(void)
+{
+	// Some task has finished; wake up any master waiting for its result.
+	__atomic_add_fetch( &s_done_epoch, 1, __ATOMIC_SEQ_CST );
+	if (__atomic_load_n( &s_waiting_masters, __ATOMIC_SEQ_CST )) {
+		thread_unpark( &s_done_epoch, UINT_MAX );
+	}
+}
+
+static bool is_foldable( value_t reducer, value_t item )
+{
+	// Adding or multiplying exact numbers - integers and rationals - is
+	// associative, and so is concatenating strings the runtime built. Float
+	// arithmetic rounds at every step, so regrouping it would change the
+	// result; other objects may implement these methods however they like.
+	// We leave all of those alone.
+	if (reducer == sym_concatenate) {
+		return IsAStringLiteral( item ) || IsAStringSlice( item );
+	}
+	return IsAnInteger( item ) || IsARational( item );
+}
+
+static value_t fold_block( zone_t zone, value_t reducer, value_t *items,
+		size_t count )
+{
+	// The loop is folding its elements into an accumulator, so we can fold
+	// each block down to a partial result here in the worker, and hand the
+	// consumer a single element to fold in place of the whole block. If any
+	// element is not something we know how to fold, the block goes through as
+	// it was.
+	bool foldable = reducer && count > 1;
+	for (size_t i = 0; foldable && i < count; i++) {
+		foldable = is_foldable( reducer, items[i] );
+	}
+	value_t partial = foldable ? items[0] : NULL;
+	for (size_t i = 1; foldable && i < count; i++) {
+		partial = METHOD_1( partial, reducer, items[i] );
+		foldable = !IsAnException( partial );
 	}
-	return false;
+	return foldable ?
+			TupleFromArray( zone, &partial, 1 ) :
+			TupleFromArray( zone, items, count );
 }
 
 static void process_iterator( zone_t zone, value_t it )
@@ -180,85 +801,267 @@ static void process_iterator( zone_t zone, value_t it )
 	value_t source = iter->slots[ITERATOR_WRAPPED_SLOT];
 	if (!source) return;
 
-	// Find out whether the iterator is valid, or is the terminator.
-	value_t valid = METHOD_0( source, sym_is_valid );
-	iter->slots[ITERATOR_VALID_SLOT] = valid;
+	// Find out how many elements this block will hold, and where the next
+	// block begins. A random-access sequence is split by index, so the block
+	// is simply the next run of indexes, up to the sequence's size. Otherwise
+	// we must step through the source iterators; if the very first one is
+	// invalid, or fails, this is the terminator.
+	struct loop_stats *stats =
+			BUFDATA( iter->slots[ITERATOR_STATS_SLOT], struct loop_stats );
+	size_t limit = block_size( stats );
+	uint64_t start = clock_ns();
+	value_t seq = iter->slots[ITERATOR_SEQUENCE_SLOT];
+	value_t sources[BATCH_LIMIT];
+	size_t count = 0;
+	value_t rest = NULL;
+	if (seq) {
+		size_t index = 0, size = 0;
+		SizeFromNumber( source, &index );
+		SizeFromNumber( iter->slots[ITERATOR_SIZE_SLOT], &size );
+		while (count < limit && index + count < size) {
+			sources[count] = NumberFromSize( zone, index + count );
+			count++;
+		}
+		iter->slots[ITERATOR_VALID_SLOT] = BooleanFromBool( count > 0 );
+		if (count > 0) {
+			rest = wrap_index_range( zone, seq, index + count,
+					iter->slots[ITERATOR_SIZE_SLOT],
+					iter->slots[ITERATOR_STATS_SLOT] );
+		}
+	} else {
+		value_t valid = NULL;
+		while (count < limit && !IsAnException( source )) {
+			valid = METHOD_0( source, sym_is_valid );
+			if (IsAnException( valid ) || !BoolFromBoolean( zone, valid )) {
+				break;
+			}
+			sources[count++] = source;
+			source = METHOD_0( source, sym_next );
+		}
+		iter->slots[ITERATOR_VALID_SLOT] =
+				count > 0 ? BooleanFromBool( true ) :
+				IsAnException( source ) ? source : valid;
+		if (count > 0) {
+			rest = wrap_source_iterator(
+					zone, source, iter->slots[ITERATOR_STATS_SLOT] );
+		}
+	}
 
-	if (BoolFromBoolean( zone, valid )) {
-		// Get a reference to the next iterator in the sequence. We do this
-		// before evaluating the element value in hopes of getting it running
-		// on a(nother) worker.
-		value_t next = METHOD_0( source, sym_next );
-		iter->slots[ITERATOR_NEXT_SLOT] = wrap_source_iterator( zone, next );
+	if (count > 0) {
+		// Publish the next block in the sequence. We do this before
+		// evaluating the element values in hopes of getting it running on
+		// a(nother) worker. Publishing it lets the master find it while
+		// walking down the chain.
+		__atomic_store_n(
+				&iter->slots[ITERATOR_NEXT_SLOT], rest, __ATOMIC_RELEASE );
 
-		// Evaluate the element value. If we are lucky, this will take a long
-		// time.
-		value_t current = METHOD_0( source, sym_current );
-		iter->slots[ITERATOR_CURRENT_SLOT] = current;
+		// Evaluate the element values. If we are lucky, this will take a long
+		// time. A worker does this in a private zone, which the consumer will
+		// collect when it takes the block.
+		zone_t results = s_self ? zone_create() : NULL;
+		zone_t target = results ? results : zone;
+		zone_t outer = s_private;
+		s_private = results ? results : outer;
+		value_t items = NULL;
+		{
+			zone_t zone = target;
+			for (size_t i = 0; i < count; i++) {
+				sources[i] = seq ?
+						METHOD_1( seq, sym_lookup, sources[i] ) :
+						METHOD_0( sources[i], sym_current );
+			}
+			items = fold_block( zone, stats->reducer, sources, count );
+		}
+		s_private = outer;
+		record_sample( &stats->map_ns, (clock_ns() - start) / count );
+		__atomic_add_fetch( &stats->samples, 1, __ATOMIC_RELAXED );
+		iter->slots[ITERATOR_ITEMS_SLOT] = items;
+		struct handover *handover =
+				BUFDATA( iter->slots[ITERATOR_HANDOVER_SLOT], struct handover );
+		handover->results = results;
+		if (results) {
+			handover->owner = it;
+			add_pending( handover );
+		}
+		handover->items = count;
+		handover->bytes = results ? zone_footprint( results ) : 0;
+		__atomic_add_fetch( &stats->ahead_items, count, __ATOMIC_RELAXED );
+		__atomic_add_fetch(
+				&stats->ahead_bytes, handover->bytes, __ATOMIC_RELAXED );
+		__atomic_add_fetch( &s_counters.blocks, 1, __ATOMIC_RELAXED );
 	}
 	
 	// Zero out the source reference. This is how we signal that the iterator
 	// wrapper has already been flattened and does not need any more processing.
-	iter->slots[ITERATOR_WRAPPED_SLOT] = NULL;
+	// Then wake up any master waiting for a result.
+	__atomic_store_n(
+			&iter->slots[ITERATOR_WRAPPED_SLOT], NULL, __ATOMIC_RELEASE );
+	announce_done();
+}
+
+static void run_work( struct work *work )
+{
+	// Whoever takes a task from a deque runs it, unless it is an iterator
+	// which some thread has already claimed by walking down its chain.
+	if (work->task->function == (function_t)future) {
+		run_future( work->zone, work->task, s_self != NULL );
+	} else if (claim_work( work->task )) {
+		process_iterator( work->zone, work->task );
+	}
+}
+
+static bool run_queued_work(void)
+{
+	// Announce that we are about to touch the heap before checking whether we
+	// are allowed to, so that parallel_quiesce() cannot miss us.
+	__atomic_add_fetch( &s_active, 1, __ATOMIC_SEQ_CST );
+	struct work work;
+	bool found = !__atomic_load_n( &s_paused, __ATOMIC_SEQ_CST ) &&
+			take_work( &work );
+	if (found) {
+		__atomic_sub_fetch( &s_queued, 1, __ATOMIC_SEQ_CST );
+		run_work( &work );
+	}
+	__atomic_sub_fetch( &s_active, 1, __ATOMIC_SEQ_CST );
+	return found;
 }
 
 static void *worker_main(void *arg)
 {
 	// Welcome to the worker thread.
-	// We live to serve. The argument points at our worker_t struct, which is
-	// where we will find instructions. The worker does not ever actually die;
-	// it just eventually gets killed when the app exits. Our job is to process
-	// iterators. If there are no iterators waiting to be processed, we do
-	// nothing. We clear out our task variable to signal that we are done with
-	// it. Some future process, wishing to get its own iterator going, will
-	// assign a new task, which we will duly execute, ad infinitum.
-	worker_t *self = (worker_t*)arg;
+	// We live to serve. The argument points at our worker_t struct, which
+	// holds our deque. The worker does not ever actually die; it just
+	// eventually gets killed when the app exits. Our job is to run tasks,
+	// from our own deque or from anyone else's. When there are none, we spin
+	// briefly, then park until someone queues another.
+	s_self = (worker_t*)arg;
+	if (s_self->proc_count) {
+		thread_pin_self( s_self->procs, s_self->proc_count );
+	}
+	if (s_self->node >= 0) {
+		page_prefer_node( s_self->node );
+	}
+	unsigned int spins = 0;
 	while (true) {
-		if (self->task) {
-			assert( !is_work_finished( self->task ) );
-			assert( self->zone );
-			// There is a problem here. We do the iterator-processing work in
-			// the worker's zone, but the data needs to end up back in the
-			// zone belonging to whomever is asking for the iterator's value.
-			// Perhaps we should create a temporary zone for use during this
-			// process_iterator call, then copy/collect the data back when the
-			// client asks for it.
-			process_iterator( self->zone, self->task );
-			self->zone = NULL;
-			self->task = NULL;
+		unsigned int epoch = __atomic_load_n( &s_work_epoch, __ATOMIC_SEQ_CST );
+		if (run_queued_work()) {
+			spins = 0;
+			continue;
+		}
+		if (spins++ < SPIN_LIMIT) {
+			CPU_RELAX();
+			continue;
 		}
+		// Announce that we are going to sleep before we actually do, so that
+		// anyone who queues work after we read the epoch knows to wake us;
+		// if the epoch has already moved on, we will not sleep at all.
+		__atomic_add_fetch( &s_idle_workers, 1, __ATOMIC_SEQ_CST );
+		thread_park( &s_work_epoch, epoch );
+		__atomic_sub_fetch( &s_idle_workers, 1, __ATOMIC_SEQ_CST );
+		spins = 0;
 	}
 	return NULL;
 }
 
-static void master_do_work( zone_t zone, value_t iter )
+static bool master_do_work( zone_t zone, value_t iter )
 {
 	// Reduce loop wants data from this iterator. Do some work until it is
-	// ready to go. We will work on this item if it is not already in progress;
-	// otherwise we will work on whatever is at the end of the chain.
-	while (!is_work_finished(iter)) {
+	// ready to go. We will work on this item if nobody has claimed it yet;
+	// otherwise we will work on whatever is at the end of the chain, or on
+	// anything else which is waiting in a queue. Returns true if we had to
+	// stall for want of anything to do.
+	unsigned int spins = 0;
+	bool stalled = false;
+	while (!is_work_finished( iter )) {
+		unsigned int epoch = __atomic_load_n( &s_done_epoch, __ATOMIC_SEQ_CST );
 		// Walk down the iterator chain looking for some useful work to do. If
 		// we find an iterator that has been created but is not yet in progress,
 		// we'll yank it for ourselves.
 		value_t next = iter;
-		while (next && (is_work_finished(next) || is_work_in_progress(next))) {
-			next = next->slots[ITERATOR_NEXT_SLOT];
+		while (next && (is_work_finished( next ) || is_work_claimed( next ))) {
+			next = next_in_chain( next );
 		}
-		if (next) {
+		if (next && claim_work( next )) {
 			process_iterator( zone, next );
+			spins = 0;
+			continue;
 		}
-		else {
-			// We are waiting on an item which is not ready, but there is no
-			// work for us to do. This is bad! For now we will just spinwait,
-			// but someday we should come up with an architecture that lets the
-			// master do something useful while waiting for its workers. This
-			// might be less of a problem when we have some concurrency system;
-			// this master can just put itself to sleep and let some other task
-			// take over for a while.
+		if (run_queued_work()) {
+			spins = 0;
+			continue;
 		}
+		// We are waiting on an item somebody else is working on, and there
+		// is nothing else we can do to help. Spin for a little while in case
+		// it is nearly done, then go to sleep until some task finishes.
+		stalled = true;
+		if (spins++ < SPIN_LIMIT) {
+			CPU_RELAX();
+			continue;
+		}
+		__atomic_add_fetch( &s_waiting_masters, 1, __ATOMIC_SEQ_CST );
+		if (!is_work_finished( iter )) {
+			thread_park( &s_done_epoch, epoch );
+		}
+		__atomic_sub_fetch( &s_waiting_masters, 1, __ATOMIC_SEQ_CST );
+		spins = 0;
+	}
+	return stalled;
+}
+
+static void hand_over( zone_t zone, value_t iter )
+{
+	// The consumer is about to look at this iterator's values. If a worker
+	// computed the block in a private zone, bring it home.
+	struct handover *handover =
+			BUFDATA( iter->slots[ITERATOR_HANDOVER_SLOT], struct handover );
+	zone_t results =
+			__atomic_exchange_n( &handover->results, NULL, __ATOMIC_ACQ_REL );
+	if (results) {
+		remove_pending( handover );
+		value_t *items = &CLOSURE(iter)->slots[ITERATOR_ITEMS_SLOT];
+		*items = collect_zone( results, *items, zone );
 	}
 }
 
+static void take_iterator( zone_t zone, value_t iter )
+{
+	// The consumer has come back for the next block. The time it spent since
+	// it took the last one is the cost of the reduce stage for its elements.
+	struct handover *handover =
+			BUFDATA( iter->slots[ITERATOR_HANDOVER_SLOT], struct handover );
+	struct loop_stats *stats =
+			BUFDATA( iter->slots[ITERATOR_STATS_SLOT], struct loop_stats );
+	uint64_t last = stats->last_taken;
+	if (last && stats->last_count) {
+		uint64_t elapsed = clock_ns() - last;
+		record_sample( &stats->reduce_ns, elapsed / stats->last_count );
+	}
+	if (master_do_work( zone, iter )) {
+		__atomic_add_fetch(
+				&s_counters.consumer_stalls, 1, __ATOMIC_RELAXED );
+	}
+	hand_over( zone, iter );
+	handover->taken = true;
+	__atomic_add_fetch( &stats->consumed, 1, __ATOMIC_RELAXED );
+	__atomic_sub_fetch(
+			&stats->ahead_items, handover->items, __ATOMIC_RELAXED );
+	__atomic_sub_fetch(
+			&stats->ahead_bytes, handover->bytes, __ATOMIC_RELAXED );
+
+	// Now that the consumer has moved along, there may be room for more
+	// lookahead; offer the first iterator nobody has started on yet.
+	value_t next = iter;
+	while (next && (is_work_finished( next ) || is_work_claimed( next ))) {
+		next = next_in_chain( next );
+	}
+	if (next) {
+		offer_iterator( zone, next );
+	}
+	value_t items = iter->slots[ITERATOR_ITEMS_SLOT];
+	stats->last_count = items ? TupleSize( items ) : 0;
+	stats->last_taken = clock_ns();
+}
+
 static value_t pariter_is_valid( PREFUNC, value_t iter )
 {
 	ARGCHECK_1( iter );
@@ -268,34 +1071,117 @@ static value_t pariter_is_valid( PREFUNC, value_t iter )
 static value_t pariter_current( PREFUNC, value_t iter )
 {
 	ARGCHECK_1( iter );
-	return iter->slots[ITERATOR_CURRENT_SLOT];
+	value_t items = iter->slots[ITERATOR_ITEMS_SLOT];
+	if (!items) {
+		return ThrowCStr( zone, "the iterator is not valid" );
+	}
+	return TupleItem( items, 0 );
 }
 
 static value_t pariter_next( PREFUNC, value_t iter )
 {
 	ARGCHECK_1( iter );
-	return iter->slots[ITERATOR_NEXT_SLOT];
+	// Step into the rest of the block, if there is any.
+	value_t items = iter->slots[ITERATOR_ITEMS_SLOT];
+	if (!items) {
+		return ThrowCStr( zone, "the iterator is not valid" );
+	}
+	value_t next = iter->slots[ITERATOR_NEXT_SLOT];
+	if (TupleSize( items ) > 1) {
+		return ResumeBatch( zone, items, 1, next );
+	}
+	return next;
+}
+
+static value_t pariter_next_n( PREFUNC, value_t iter, value_t count )
+{
+	ARGCHECK_2( iter, count );
+	// Hand over the whole block as a batch, if the caller has room for it.
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch size must be an integer" );
+	}
+	value_t items = iter->slots[ITERATOR_ITEMS_SLOT];
+	if (!items) {
+		value_t valid = iter->slots[ITERATOR_VALID_SLOT];
+		if (IsAnException( valid )) return valid;
+		return MakeBatch( zone, NULL, 0, iter );
+	}
+	value_t next = iter->slots[ITERATOR_NEXT_SLOT];
+	size_t size = TupleSize( items );
+	if (size <= limit) {
+		return AllocPair( zone, items, next );
+	}
+	value_t head[BATCH_LIMIT];
+	for (size_t i = 0; i < limit; i++) {
+		head[i] = TupleItem( items, i );
+	}
+	value_t rest = limit ? ResumeBatch( zone, items, limit, next ) : iter;
+	return MakeBatch( zone, head, limit, rest );
 }
 
 static value_t pariter( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	master_do_work( zone, self );
+	struct handover *handover =
+			BUFDATA( self->slots[ITERATOR_HANDOVER_SLOT], struct handover );
+	if (!handover->taken) {
+		take_iterator( zone, self );
+	}
 	DEFINE_METHOD(is_valid, pariter_is_valid)
 	DEFINE_METHOD(current, pariter_current)
 	DEFINE_METHOD(next, pariter_next)
+	DEFINE_METHOD(next_n, pariter_next_n)
 	return ThrowCStr( zone, "iterator does not have the requested method" );
 }
 
-static value_t wrap_source_iterator( zone_t zone, value_t original )
+static value_t new_wrapper(
+		zone_t zone, value_t source, value_t seq, value_t size, value_t stats )
+{
+	struct closure *out = ALLOC( pariter, ITERATOR_SLOT_COUNT );
+	out->slots[ITERATOR_WRAPPED_SLOT] = source;
+	out->slots[ITERATOR_VALID_SLOT] = NULL;
+	out->slots[ITERATOR_ITEMS_SLOT] = NULL;
+	out->slots[ITERATOR_NEXT_SLOT] = NULL;
+	out->slots[ITERATOR_CLAIM_SLOT] = NULL;
+	struct buffer *record = Buffer( zone, sizeof(struct handover) );
+	struct handover *handover = BUFDATA( record, struct handover );
+	handover->results = NULL;
+	handover->owner = NULL;
+	handover->prev = NULL;
+	handover->next = NULL;
+	handover->offered = false;
+	handover->taken = false;
+	handover->listed = false;
+	handover->items = 0;
+	handover->bytes = 0;
+	out->slots[ITERATOR_HANDOVER_SLOT] = (value_t)record;
+	out->slots[ITERATOR_STATS_SLOT] = stats;
+	out->slots[ITERATOR_SEQUENCE_SLOT] = seq;
+	out->slots[ITERATOR_SIZE_SLOT] = size;
+	struct loop_stats *loop = BUFDATA( stats, struct loop_stats );
+	__atomic_add_fetch( &loop->created, 1, __ATOMIC_RELAXED );
+	offer_iterator( zone, out );
+	return out;
+}
+
+static value_t wrap_source_iterator(
+		zone_t zone, value_t original, value_t stats )
 {
 	if (IsAnException( original )) return original;
 	// Here's an iterator from the original sequence. Wrap it in one of our
 	// parallelized iterators, then try to get one of our workers going on it.
-	struct closure *out = ALLOC( pariter, ITERATOR_SLOT_COUNT );
-	out->slots[ITERATOR_WRAPPED_SLOT] = original;
-	queue_iterator( zone, out );
-	return out;
+	return new_wrapper( zone, original, NULL, NULL, stats );
+}
+
+static value_t wrap_index_range(
+		zone_t zone, value_t seq, size_t index, value_t size, value_t stats )
+{
+	// Here's the rest of a random-access sequence, from the given index on.
+	// Its wrapper is a block of indexes, which a worker can look up without
+	// waiting for anyone to walk through the elements before it.
+	value_t start = NumberFromSize( zone, index );
+	return new_wrapper( zone, start, seq, size, stats );
 }
 
 static value_t parseq_iterate( PREFUNC, value_t sequence )
@@ -305,10 +1191,32 @@ static value_t parseq_iterate( PREFUNC, value_t sequence )
 	// first iterator. Wrap that iterator in our populated-iterator wrapper,
 	// which will compute and pull the "current" value and then keep pulling
 	// iterators until it has gotten all of the workers in on the game.
+	// A random-access sequence we split by index instead: each block is a
+	// range of indexes, so finding the next block means no calls into the
+	// sequence at all, and the workers can partition the whole range among
+	// themselves while each looks up the elements of its own blocks.
+	// A worker computing in its private zone runs any loop it meets there by
+	// itself. The zone is destroyed as soon as the consumer takes the result,
+	// so no wrapper, queued task, or pending block may be left in it for other
+	// threads to find afterwards.
 	value_t original_sequence = sequence->slots[0];
+	if (zone == s_private) {
+		return METHOD_0( original_sequence, sym_iterate );
+	}
+	if (IsRandomAccess( zone, original_sequence )) {
+		value_t size = METHOD_0( original_sequence, sym_size );
+		if (IsAnException( size )) return size;
+		size_t count = 0;
+		if (!ClampedSizeFromNumber( size, &count )) {
+			return ThrowCStr( zone, "sequence size is not an integer" );
+		}
+		size = NumberFromSize( zone, count );
+		return wrap_index_range(
+				zone, original_sequence, 0, size, sequence->slots[1] );
+	}
 	value_t src_iterator = METHOD_0( original_sequence, sym_iterate );
 	if (IsAnException( src_iterator )) return src_iterator;
-	return wrap_source_iterator( zone, src_iterator );
+	return wrap_source_iterator( zone, src_iterator, sequence->slots[1] );
 }
 
 static value_t parseq( PREFUNC, value_t selector )
@@ -329,9 +1237,288 @@ static value_t parallelize_func( PREFUNC, value_t exp )
 	// evaluation engine. It would make no sense to parallelize a parallel
 	// sequence, and anyway that should be impossible.
 	assert( exp->function != (function_t)parseq );
-	struct closure *out = ALLOC( parseq, 1 );
+	// The timing statistics belong to the sequence, so they carry over if the
+	// loop iterates over it more than once.
+	struct buffer *stats = Buffer( zone, sizeof(struct loop_stats) );
+	memset( stats->bytes, 0, sizeof(struct loop_stats) );
+	BUFDATA( stats, struct loop_stats )->window_items = s_window_items;
+	BUFDATA( stats, struct loop_stats )->window_bytes = s_window_bytes;
+	struct closure *out = ALLOC( parseq, 2 );
 	out->slots[0] = exp;
+	out->slots[1] = (value_t)stats;
 	return out;
 }
 struct closure parallelize = {(function_t)parallelize_func};
 
+static value_t parallel_reduce_func(
+		PREFUNC, value_t exp, value_t method, value_t start )
+{
+	ARGCHECK_3( exp, method, start );
+	// The compiler found a loop whose only work, besides stepping through the
+	// sequence, is folding each element into an accumulator with the given
+	// method. Whether that fold is associative depends on the types involved,
+	// which we can only learn now, from the accumulator's starting value; if
+	// it passes, the workers may fold each block before handing it over.
+	value_t out = parallelize_func( zone, &parallelize, 1, exp );
+	if (out == exp || IsAnException( out )) return out;
+	bool known = method == sym_add || method == sym_multiply ||
+			method == sym_concatenate;
+	if (known && is_foldable( method, start )) {
+		value_t stats = CLOSURE(out)->slots[1];
+		BUFDATA( stats, struct loop_stats )->reducer = method;
+	}
+	return out;
+}
+struct closure parallel_reduce = {(function_t)parallel_reduce_func};
+
+
+// Not all of the work worth sharing is in loops. When the arguments to some
+// call include calls to functions which contain loops, and those calls do not
+// depend on each other, the compiler spawns all but one of them as futures
+// and evaluates the last in place before joining the rest. A future is a task
+// on the same deques as the iterators, and since joins come in the reverse
+// order of spawns, a future nobody has stolen is always at the bottom of its
+// spawner's deque by the time the spawner joins it; the spawner then simply
+// takes it back and runs it itself. As with loop blocks, a worker computes a
+// future in a private zone, which the joiner collects into its own.
+// A function with a loop in it may still be quick, so we time the calls to
+// each function we spawn, and once calls to a function have proven too quick
+// to be worth handing over, we make them in place instead.
+
+// future object slots
+//	0: function to call
+//	1: arguments for the call, as a tuple
+//	2: result of the call, once it is done
+//	3: claim marker, set by whichever thread runs the call
+//	4: promise record, a buffer holding a struct promise
+#define FUTURE_SLOT_COUNT 5
+#define FUTURE_TARGET_SLOT 0
+#define FUTURE_ARGS_SLOT 1
+#define FUTURE_RESULT_SLOT 2
+#define FUTURE_CLAIM_SLOT 3
+#define FUTURE_PROMISE_SLOT 4
+struct promise {
+	zone_t results;         // private zone holding the result, if any
+	bool queued;            // did the future make it onto a deque?
+	bool done;              // has the result been stored?
+};
+
+// Call timings live in a small table keyed by the code of the function
+// called. The table never shrinks; once it is full, functions without an
+// entry are always spawned.
+#define CALL_TABLE_SIZE 256
+#define CHEAP_CALL_NS 10000
+struct call_stats {
+	function_t code;
+	uint64_t call_ns;       // moving average time to make the call
+	unsigned int samples;   // number of calls timed so far
+};
+static struct call_stats s_calls[CALL_TABLE_SIZE];
+
+static struct call_stats *call_stats( value_t target )
+{
+	function_t code = target->function;
+	size_t hash = ((uintptr_t)code >> 4) % CALL_TABLE_SIZE;
+	for (size_t i = 0; i < CALL_TABLE_SIZE; i++) {
+		struct call_stats *entry = &s_calls[(hash + i) % CALL_TABLE_SIZE];
+		function_t found = __atomic_load_n( &entry->code, __ATOMIC_ACQUIRE );
+		if (!found && __atomic_compare_exchange_n( &entry->code, &found,
+				code, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE )) {
+			return entry;
+		}
+		if (found == code) return entry;
+	}
+	return NULL;
+}
+
+static bool is_cheap_call( struct call_stats *stats )
+{
+	if (!stats) return false;
+	if (__atomic_load_n( &stats->samples, __ATOMIC_RELAXED ) < WARMUP_SAMPLES) {
+		return false;
+	}
+	return __atomic_load_n( &stats->call_ns, __ATOMIC_RELAXED ) < CHEAP_CALL_NS;
+}
+
+static value_t timed_call( zone_t zone, value_t target, value_t args )
+{
+	// Call the target with the arguments in the tuple, and record how long
+	// the call took. The compiler only spawns calls with one to four
+	// arguments.
+	uint64_t start = clock_ns();
+	value_t out = NULL;
+	switch (TupleSize( args )) {
+		case 1: out = CALL_1( target, TupleItem( args, 0 ) ); break;
+		case 2: out = CALL_2( target,
+				TupleItem( args, 0 ), TupleItem( args, 1 ) ); break;
+		case 3: out = CALL_3( target, TupleItem( args, 0 ),
+				TupleItem( args, 1 ), TupleItem( args, 2 ) ); break;
+		case 4: out = CALL_4( target, TupleItem( args, 0 ),
+				TupleItem( args, 1 ), TupleItem( args, 2 ),
+				TupleItem( args, 3 ) ); break;
+		default: return ThrowCStr( zone, "future has too many arguments" );
+	}
+	struct call_stats *stats = call_stats( target );
+	if (stats) {
+		record_sample( &stats->call_ns, clock_ns() - start );
+		__atomic_add_fetch( &stats->samples, 1, __ATOMIC_RELAXED );
+	}
+	return out;
+}
+
+static value_t future( PREFUNC )
+{
+	// Futures only ever pass from spawn_future to join_future; nobody else
+	// has any business calling one.
+	return ThrowCStr( zone, "a future cannot be called" );
+}
+
+static bool claim_future( value_t task )
+{
+	value_t expected = NULL;
+	return __atomic_compare_exchange_n(
+			&CLOSURE(task)->slots[FUTURE_CLAIM_SLOT],
+			&expected,
+			&True_returner,
+			false,
+			__ATOMIC_ACQ_REL,
+			__ATOMIC_RELAXED );
+}
+
+static bool is_future_claimed( value_t task )
+{
+	return NULL != __atomic_load_n(
+			&task->slots[FUTURE_CLAIM_SLOT], __ATOMIC_ACQUIRE );
+}
+
+static bool is_future_done( value_t task )
+{
+	value_t record = task->slots[FUTURE_PROMISE_SLOT];
+	return __atomic_load_n(
+			&BUFDATA( record, struct promise )->done, __ATOMIC_ACQUIRE );
+}
+
+static void run_future( zone_t zone, value_t task, bool detached )
+{
+	// Make the call, unless some other thread has already started on it. A
+	// worker which took the future from a deque computes the result in a
+	// private zone; the joiner, or a master lending a hand, uses the zone it
+	// was given.
+	if (!claim_future( task )) return;
+	struct closure *it = CLOSURE(task);
+	struct promise *promise =
+			BUFDATA( it->slots[FUTURE_PROMISE_SLOT], struct promise );
+	zone_t results = detached ? zone_create() : NULL;
+	zone_t outer = s_private;
+	s_private = results ? results : outer;
+	value_t result = timed_call( results ? results : zone,
+			it->slots[FUTURE_TARGET_SLOT], it->slots[FUTURE_ARGS_SLOT] );
+	s_private = outer;
+	it->slots[FUTURE_RESULT_SLOT] = result;
+	promise->results = results;
+	__atomic_store_n( &promise->done, true, __ATOMIC_RELEASE );
+	announce_done();
+}
+
+static bool pop_own_work( struct work *out )
+{
+	// Take the task most recently queued by this thread, or by one of the
+	// other threads which share the non-worker deque.
+	bool found = false;
+	if (s_self) {
+		found = deque_pop( &s_self->queue, out );
+	} else {
+		thread_mutex_lock( &s_shared_lock );
+		found = deque_pop( &s_shared_queue, out );
+		thread_mutex_unlock( &s_shared_lock );
+	}
+	if (found) {
+		__atomic_sub_fetch( &s_queued, 1, __ATOMIC_SEQ_CST );
+	}
+	return found;
+}
+
+static void wait_for_future( zone_t zone, value_t task )
+{
+	// Everything queued since the future was spawned has either been run or
+	// stolen, so if the future is still on our deque it is at the bottom.
+	// Work our way down to it; if it is not there, a thief has it, or it
+	// never made it onto the deque, or the queues were cleared while the IO
+	// loop collected garbage, and we run it ourselves if nobody else has
+	// started. Otherwise we help with whatever else is queued until it is
+	// done, just as a loop's consumer does.
+	value_t record = task->slots[FUTURE_PROMISE_SLOT];
+	struct work work;
+	while (BUFDATA( record, struct promise )->queued &&
+			!is_future_claimed( task ) && pop_own_work( &work )) {
+		if (work.task == task) break;
+		run_work( &work );
+	}
+	run_future( zone, task, false );
+	unsigned int spins = 0;
+	while (!is_future_done( task )) {
+		unsigned int epoch = __atomic_load_n( &s_done_epoch, __ATOMIC_SEQ_CST );
+		if (run_queued_work()) {
+			spins = 0;
+			continue;
+		}
+		if (spins++ < SPIN_LIMIT) {
+			CPU_RELAX();
+			continue;
+		}
+		__atomic_add_fetch( &s_waiting_masters, 1, __ATOMIC_SEQ_CST );
+		if (!is_future_done( task )) {
+			thread_park( &s_done_epoch, epoch );
+		}
+		__atomic_sub_fetch( &s_waiting_masters, 1, __ATOMIC_SEQ_CST );
+		spins = 0;
+	}
+}
+
+static value_t spawn_future_func( PREFUNC, value_t target, value_t args )
+{
+	ARGCHECK_2( target, args );
+	// If there is nobody to hand the call to, or calls to this function have
+	// proven too quick to be worth the trouble, make the call right away;
+	// join_future passes anything which is not a future straight through.
+	if (0 == s_num_workers) {
+		return timed_call( zone, target, args );
+	}
+	if (is_cheap_call( call_stats( target ) )) {
+		return timed_call( zone, target, args );
+	}
+	struct closure *out = ALLOC( future, FUTURE_SLOT_COUNT );
+	out->slots[FUTURE_TARGET_SLOT] = target;
+	out->slots[FUTURE_ARGS_SLOT] = args;
+	out->slots[FUTURE_RESULT_SLOT] = NULL;
+	out->slots[FUTURE_CLAIM_SLOT] = NULL;
+	struct buffer *record = Buffer( zone, sizeof(struct promise) );
+	struct promise *promise = BUFDATA( record, struct promise );
+	promise->results = NULL;
+	promise->queued = false;
+	promise->done = false;
+	out->slots[FUTURE_PROMISE_SLOT] = (value_t)record;
+	promise->queued = queue_task( zone, out );
+	return out;
+}
+struct closure spawn_future = {(function_t)spawn_future_func};
+
+static value_t join_future_func( PREFUNC, value_t task, value_t after )
+{
+	// The second argument is the work this thread did while the future ran;
+	// we only take it so that the compiler will schedule that work first. Its
+	// value is none of our business, even if it is an exception.
+	if (TRACE) fprintf( stderr, "%s\n", __func__ );
+	if (argc != 2) return ThrowArgCountFail( zone, __func__, 2, argc );
+	if (task->function != (function_t)future) return task;
+	wait_for_future( zone, task );
+	struct promise *promise =
+			BUFDATA( task->slots[FUTURE_PROMISE_SLOT], struct promise );
+	value_t *result = &CLOSURE(task)->slots[FUTURE_RESULT_SLOT];
+	if (promise->results) {
+		*result = collect_zone( promise->results, *result, zone );
+		promise->results = NULL;
+	}
+	return *result;
+}
+struct closure join_future = {(function_t)join_future_func};
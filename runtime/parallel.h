@@ -21,9 +21,54 @@
 #ifndef parallel_h
 #define parallel_h
 
+#include <stdint.h>
 #include "closures.h"
 
+// The runtime normally starts one worker for each processor the process may
+// use, less one, and lets them run wherever the system puts them. A program
+// embedding the runtime may choose otherwise by calling configure_parallel()
+// before init_runtime(), though the environment variables RADIAN_WORKERS,
+// RADIAN_PIN and RADIAN_NUMA_NODE override its choices. parallel_config()
+// reports the configuration actually in effect.
+enum parallel_pinning {
+	PIN_NONE,               // workers run wherever the system puts them
+	PIN_CORE,               // every thread has a processor of its own
+	PIN_NODE                // each worker stays within one NUMA node
+};
+struct parallel_config {
+	int workers;            // number of worker threads, or -1 for the default
+	enum parallel_pinning pinning;
+	int numa_node;          // node for the workers and their memory, or -1
+};
+void configure_parallel( const struct parallel_config *config );
+void parallel_config( struct parallel_config *out );
+
 void init_parallel(void);
 extern struct closure parallelize;
+extern struct closure parallel_reduce;
+
+// Calls the compiler has chosen to run alongside other work. spawn_future
+// hands the call to a worker, or makes it in place if that would not be worth
+// the trouble; join_future waits for it and returns its result.
+extern struct closure spawn_future;
+extern struct closure join_future;
+
+// Workers may be computing elements in the background whenever a parallel
+// loop or a generator is in progress. Anyone about to collect a zone which
+// those loops might use must quiesce the workers first, and resume them once
+// the collection is done.
+void parallel_quiesce( zone_t zone );
+void parallel_resume(void);
+
+// How often has each side of a parallel loop had to wait for the other? A
+// producer stall is a block the workers could have started, but did not
+// because the loop's lookahead window was full; a consumer stall is a block
+// the consumer wanted before anyone had finished computing it.
+struct parallel_counters {
+	uint64_t blocks;
+	uint64_t producer_stalls;
+	uint64_t consumer_stalls;
+};
+void parallel_counters( struct parallel_counters *out );
 
 #endif	//parallel_h
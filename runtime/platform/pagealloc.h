@@ -42,4 +42,9 @@ void *multipage_alloc(size_t bytes);
 // Release a multiple-page block. Yes, we have to keep track of its length.
 void multipage_free(void* block, size_t bytes);
 
+// Place the pages this thread allocates from now on in the memory of the given
+// NUMA node, where the platform supports it, or wherever the system likes if
+// the node is -1.
+void page_prefer_node(int node);
+
 #endif	//pagealloc_h
@@ -34,6 +34,26 @@ int thread_mutex_lock( thread_mutex_t* );
 int thread_mutex_unlock( thread_mutex_t* );
 void thread_mutex_destroy( thread_mutex_t* );
 
+// How many processors may this process use? This is the number in its
+// affinity mask, or the CPU quota of its control group, rounded up to whole
+// processors, if that is fewer.
 unsigned int thread_count_procs(void);
 
+// Which processors are in this process's affinity mask? Fills the array with
+// up to 'max' processor numbers and returns how many it found. Each processor
+// belongs to a NUMA node, or -1 if the platform cannot say. A thread may pin
+// itself to some set of the processors; pinning returns zero on success, like
+// the mutex functions.
+unsigned int thread_list_procs( unsigned int *procs, unsigned int max );
+int thread_proc_node( unsigned int proc );
+int thread_pin_self( const unsigned int *procs, unsigned int count );
+
+// Parking lets a thread sleep until some other thread changes a word of
+// memory. thread_park returns immediately if the word no longer holds the
+// expected value; otherwise it sleeps until a call to thread_unpark on the
+// same word wakes it, though it may also wake spuriously. thread_unpark wakes
+// up to 'count' parked threads. On Linux these are futex wait and wake.
+void thread_park( unsigned int *word, unsigned int expected );
+void thread_unpark( unsigned int *word, unsigned int count );
+
 #endif //threads_h
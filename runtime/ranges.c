@@ -0,0 +1,244 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+#include <limits.h>
+#include "ranges.h"
+#include "sequences.h"
+#include "atoms/numbers.h"
+#include "atoms/booleans.h"
+#include "atoms/symbols.h"
+#include "dispatch.h"
+#include "macros.h"
+#include "exceptions.h"
+
+// A range is an arithmetic sequence: the element at index i is min + i * step.
+// We keep the first element, the step, and the number of elements; the upper
+// bound the range was made with is not needed once we know its size. Every
+// element lies between the bounds, so none of this arithmetic can overflow.
+#define RANGE_SLOT_COUNT 3
+#define RANGE_MIN_SLOT 0
+#define RANGE_STEP_SLOT 1
+#define RANGE_SIZE_SLOT 2
+
+// The iterator carries the current element itself, so reading it is free and
+// advancing is one addition.
+#define RANGE_ITERATOR_SLOT_COUNT 3
+#define RANGE_ITERATOR_CURRENT_SLOT 0
+#define RANGE_ITERATOR_STEP_SLOT 1
+#define RANGE_ITERATOR_REMAINING_SLOT 2
+
+static value_t Range_function( PREFUNC, value_t selector );
+static value_t Range_iterator_function( PREFUNC, value_t selector );
+
+static value_t MakeRange( zone_t zone, int min, int step, int size )
+{
+	struct closure *out = ALLOC( Range_function, RANGE_SLOT_COUNT );
+	out->slots[RANGE_MIN_SLOT] = NumberFromInt( zone, min );
+	out->slots[RANGE_STEP_SLOT] = NumberFromInt( zone, step );
+	out->slots[RANGE_SIZE_SLOT] = NumberFromInt( zone, size );
+	return out;
+}
+
+static value_t MakeRangeIterator(
+		zone_t zone, value_t current, value_t step, int remaining )
+{
+	struct closure *out =
+			ALLOC( Range_iterator_function, RANGE_ITERATOR_SLOT_COUNT );
+	out->slots[RANGE_ITERATOR_CURRENT_SLOT] = current;
+	out->slots[RANGE_ITERATOR_STEP_SLOT] = step;
+	out->slots[RANGE_ITERATOR_REMAINING_SLOT] =
+			NumberFromInt( zone, remaining );
+	return out;
+}
+
+static int RangeElement( value_t range, int index )
+{
+	int min = IntFromFixint( range->slots[RANGE_MIN_SLOT] );
+	int step = IntFromFixint( range->slots[RANGE_STEP_SLOT] );
+	return (int)(min + (long long)index * step);
+}
+
+static value_t Range_iterate( PREFUNC, value_t range )
+{
+	ARGCHECK_1( range );
+	int size = IntFromFixint( range->slots[RANGE_SIZE_SLOT] );
+	return MakeRangeIterator(
+			zone,
+			range->slots[RANGE_MIN_SLOT],
+			range->slots[RANGE_STEP_SLOT],
+			size );
+}
+
+static value_t Range_size( PREFUNC, value_t range )
+{
+	ARGCHECK_1( range );
+	return range->slots[RANGE_SIZE_SLOT];
+}
+
+static value_t Range_lookup( PREFUNC, value_t range, value_t index )
+{
+	ARGCHECK_2( range, index );
+	if (!IsAFixint( index )) {
+		return ThrowCStr( zone, "element index is not an integer" );
+	}
+	int size = IntFromFixint( range->slots[RANGE_SIZE_SLOT] );
+	int i = IntFromFixint( index );
+	if (i < 0 || i >= size) {
+		return ThrowCStr( zone, "element index is out of bounds" );
+	}
+	return NumberFromInt( zone, RangeElement( range, i ) );
+}
+
+static value_t Range_slice(
+		PREFUNC, value_t range, value_t skip, value_t count )
+{
+	ARGCHECK_3( range, skip, count );
+	int size = IntFromFixint( range->slots[RANGE_SIZE_SLOT] );
+	size_t begin = 0, end = 0;
+	if (!SliceBounds( skip, count, size, &begin, &end )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	if (0 == begin && (size_t)size == end) return range;
+	int step = IntFromFixint( range->slots[RANGE_STEP_SLOT] );
+	return MakeRange( zone, RangeElement( range, begin ), step, end - begin );
+}
+
+static const struct method_table Range_methods = {
+	(function_t)Range_function,
+	{
+		METHOD_ENTRY(iterate, Range_iterate),
+		METHOD_ENTRY(size, Range_size),
+		METHOD_ENTRY(lookup, Range_lookup),
+		METHOD_ENTRY(slice, Range_slice),
+	}
+};
+
+static value_t Range_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Range_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t Range_iterator_is_valid( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t remaining = iterator->slots[RANGE_ITERATOR_REMAINING_SLOT];
+	return BooleanFromBool( IntFromFixint( remaining ) > 0 );
+}
+
+static value_t Range_iterator_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	return iterator->slots[RANGE_ITERATOR_CURRENT_SLOT];
+}
+
+static value_t Range_iterator_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t remaining = iterator->slots[RANGE_ITERATOR_REMAINING_SLOT];
+	int count = IntFromFixint( remaining );
+	if (count <= 0) {
+		return ThrowCStr( zone, "iterator is not valid" );
+	}
+	// The element after the last one may lie past the bounds, and so might
+	// not fit in a fixint; nobody can read it, so we leave it alone.
+	value_t current = iterator->slots[RANGE_ITERATOR_CURRENT_SLOT];
+	value_t step = iterator->slots[RANGE_ITERATOR_STEP_SLOT];
+	if (count > 1) {
+		current = NumberFromInt(
+				zone, IntFromFixint( current ) + IntFromFixint( step ) );
+	}
+	return MakeRangeIterator( zone, current, step, count - 1 );
+}
+
+static value_t Range_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t remaining = iterator->slots[RANGE_ITERATOR_REMAINING_SLOT];
+	size_t left = IntFromFixint( remaining );
+	if (limit > left) {
+		limit = left;
+	}
+	int current = IntFromFixint( iterator->slots[RANGE_ITERATOR_CURRENT_SLOT] );
+	value_t step = iterator->slots[RANGE_ITERATOR_STEP_SLOT];
+	int step_val = IntFromFixint( step );
+	value_t items[BATCH_LIMIT];
+	for (size_t i = 0; i < limit; i++) {
+		items[i] = NumberFromInt( zone, current + (int)i * step_val );
+	}
+	// As with next, the element after the last one is never computed.
+	value_t next = iterator->slots[RANGE_ITERATOR_CURRENT_SLOT];
+	if (limit > 0 && limit < left) {
+		next = NumberFromInt( zone, current + (int)limit * step_val );
+	}
+	value_t rest = MakeRangeIterator( zone, next, step, left - limit );
+	return MakeBatch( zone, items, limit, rest );
+}
+
+static const struct method_table Range_iterator_methods = {
+	(function_t)Range_iterator_function,
+	{
+		METHOD_ENTRY(is_valid, Range_iterator_is_valid),
+		METHOD_ENTRY(current, Range_iterator_current),
+		METHOD_ENTRY(next, Range_iterator_next),
+		METHOD_ENTRY(next_n, Range_iterator_next_n),
+	}
+};
+
+static value_t Range_iterator_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Range_iterator_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t number_range_function(
+		PREFUNC, value_t min, value_t max, value_t step, value_t fallback )
+{
+	ARGCHECK_4( min, max, step, fallback );
+	if (!IsAFixint( min ) || !IsAFixint( max ) || !IsAFixint( step )) {
+		return CALL_3( fallback, min, max, step );
+	}
+	long long lo = IntFromFixint( min );
+	long long hi = IntFromFixint( max );
+	long long delta = IntFromFixint( step );
+	if (0 == delta) {
+		return CALL_3( fallback, min, max, step );
+	}
+	// The size is one more than the number of whole steps from min to max,
+	// rounding toward negative infinity, or zero if max lies behind min.
+	long long span = hi - lo;
+	long long steps = span / delta;
+	if ((span % delta != 0) && ((span < 0) != (delta < 0))) {
+		steps--;
+	}
+	long long size = (steps >= 0) ? steps + 1 : 0;
+	if (size > INT_MAX) {
+		return CALL_3( fallback, min, max, step );
+	}
+	return MakeRange( zone, (int)lo, (int)delta, (int)size );
+}
+const struct closure number_range = {(function_t)number_range_function};
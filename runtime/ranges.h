@@ -0,0 +1,35 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+
+#ifndef ranges_h
+#define ranges_h
+
+#include "closures.h"
+
+// Builtin entrypoint for number.range_with_step. A range whose bounds and
+// step are all fixints lives in the runtime, where it can report its size and
+// look up any element in constant time. Other ranges are left to the Radian
+// object made by the fallback function, which the caller passes in, and which
+// we call with the same three arguments only when we need it.
+extern const struct closure number_range;
+
+#endif //ranges_h
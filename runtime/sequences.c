@@ -0,0 +1,386 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#include <assert.h>
+#include "sequences.h"
+#include "containers/tuples.h"
+#include "atoms/numbers.h"
+#include "atoms/booleans.h"
+#include "atoms/symbols.h"
+#include "dispatch.h"
+#include "macros.h"
+#include "exceptions.h"
+
+#define INDEX_ITERATOR_SLOT_COUNT 3
+#define INDEX_ITERATOR_TARGET_SLOT 0
+#define INDEX_ITERATOR_INDEX_SLOT 1
+#define INDEX_ITERATOR_SIZE_SLOT 2
+
+#define BATCH_ITERATOR_SLOT_COUNT 3
+#define BATCH_ITERATOR_ITEMS_SLOT 0
+#define BATCH_ITERATOR_INDEX_SLOT 1
+#define BATCH_ITERATOR_REST_SLOT 2
+// How many elements a for loop asks its iterator for at a time. Only iterators
+// with a next_n method are asked, so a lazy sequence written in Radian is
+// never read ahead of the loop. Native iterators are, though: an index
+// iterator calls its sequence's lookup method for up to a whole batch of
+// elements before the loop body sees the first of them.
+#define BATCH_ITERATOR_COUNT 64
+
+static value_t Index_iterator_function( PREFUNC, value_t selector );
+static value_t Batch_iterator_function( PREFUNC, value_t selector );
+
+bool IsRandomAccess( zone_t zone, value_t seq )
+{
+	// This is what "seq has :size" would mean in Radian code: an object
+	// lacking a method returns an exception instead.
+	if (IsAnException( seq )) return false;
+	return !IsAnException( CALL_1( seq, sym_size ) ) &&
+			!IsAnException( CALL_1( seq, sym_lookup ) ) &&
+			!IsAnException( CALL_1( seq, sym_slice ) );
+}
+
+bool SliceBounds(
+		value_t skip, value_t count, size_t size, size_t *begin, size_t *end )
+{
+	size_t first = 0, length = 0;
+	if (!ClampedSizeFromNumber( skip, &first )) return false;
+	if (!ClampedSizeFromNumber( count, &length )) return false;
+	if (first > size) {
+		first = size;
+	}
+	if (length > size - first) {
+		length = size - first;
+	}
+	*begin = first;
+	*end = first + length;
+	return true;
+}
+
+static value_t MakeIndexIterator(
+		zone_t zone, value_t seq, value_t index, value_t size )
+{
+	struct closure *out =
+			ALLOC( Index_iterator_function, INDEX_ITERATOR_SLOT_COUNT );
+	out->slots[INDEX_ITERATOR_TARGET_SLOT] = seq;
+	out->slots[INDEX_ITERATOR_INDEX_SLOT] = index;
+	out->slots[INDEX_ITERATOR_SIZE_SLOT] = size;
+	return out;
+}
+
+value_t IndexIterator( zone_t zone, value_t seq )
+{
+	value_t size = METHOD_0( seq, sym_size );
+	if (IsAnException( size )) return size;
+	// The size may be a bigint, when the sequence is something large living
+	// outside the zones, such as a mapped file.
+	size_t count = 0;
+	if (!ClampedSizeFromNumber( size, &count )) {
+		return ThrowCStr( zone, "sequence size is not an integer" );
+	}
+	size = NumberFromSize( zone, count );
+	return MakeIndexIterator( zone, seq, num_zero, size );
+}
+
+static size_t IndexIteratorSlot( value_t iterator, int slot )
+{
+	size_t out = 0;
+	SizeFromNumber( iterator->slots[slot], &out );
+	return out;
+}
+
+static value_t Index_iterator_is_valid( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	size_t index = IndexIteratorSlot( iterator, INDEX_ITERATOR_INDEX_SLOT );
+	size_t size = IndexIteratorSlot( iterator, INDEX_ITERATOR_SIZE_SLOT );
+	return BooleanFromBool( index < size );
+}
+
+static value_t Index_iterator_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t seq = iterator->slots[INDEX_ITERATOR_TARGET_SLOT];
+	value_t index = iterator->slots[INDEX_ITERATOR_INDEX_SLOT];
+	return METHOD_1( seq, sym_lookup, index );
+}
+
+static value_t Index_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t seq = iterator->slots[INDEX_ITERATOR_TARGET_SLOT];
+	size_t index = IndexIteratorSlot( iterator, INDEX_ITERATOR_INDEX_SLOT );
+	size_t size = IndexIteratorSlot( iterator, INDEX_ITERATOR_SIZE_SLOT );
+	value_t items[BATCH_LIMIT];
+	size_t taken = 0;
+	while (taken < limit && index < size) {
+		value_t key = NumberFromSize( zone, index++ );
+		items[taken++] = METHOD_1( seq, sym_lookup, key );
+	}
+	value_t rest = MakeIndexIterator(
+			zone,
+			seq,
+			NumberFromSize( zone, index ),
+			iterator->slots[INDEX_ITERATOR_SIZE_SLOT] );
+	return MakeBatch( zone, items, taken, rest );
+}
+
+static value_t Index_iterator_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	size_t index = IndexIteratorSlot( iterator, INDEX_ITERATOR_INDEX_SLOT );
+	return MakeIndexIterator(
+			zone,
+			iterator->slots[INDEX_ITERATOR_TARGET_SLOT],
+			NumberFromSize( zone, index + 1 ),
+			iterator->slots[INDEX_ITERATOR_SIZE_SLOT] );
+}
+
+static const struct method_table Index_iterator_methods = {
+	(function_t)Index_iterator_function,
+	{
+		METHOD_ENTRY(is_valid, Index_iterator_is_valid),
+		METHOD_ENTRY(current, Index_iterator_current),
+		METHOD_ENTRY(next, Index_iterator_next),
+		METHOD_ENTRY(next_n, Index_iterator_next_n),
+	}
+};
+
+static value_t Index_iterator_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Index_iterator_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+bool BatchCount( value_t count, size_t *out )
+{
+	if (!IsAFixint( count )) return false;
+	int value = IntFromFixint( count );
+	if (value < 0) {
+		value = 0;
+	}
+	*out = (value < BATCH_LIMIT) ? value : BATCH_LIMIT;
+	return true;
+}
+
+value_t MakeBatch(
+		zone_t zone, const value_t *items, size_t count, value_t rest )
+{
+	return AllocPair( zone, TupleFromArray( zone, items, count ), rest );
+}
+
+static value_t StepBatch( zone_t zone, value_t iterator, size_t count )
+{
+	// The iterator has no batch method of its own, so we will step through it
+	// the long way. If the iterator fails partway, we hand over the elements
+	// we have so far; the failure will come up again when the caller asks for
+	// the next batch, in the same place it would have come up anyway.
+	value_t items[BATCH_LIMIT];
+	size_t taken = 0;
+	if (count > BATCH_LIMIT) {
+		count = BATCH_LIMIT;
+	}
+	while (taken < count) {
+		value_t valid = METHOD_0( iterator, sym_is_valid );
+		if (IsAnException( valid )) {
+			if (0 == taken) return valid;
+			break;
+		}
+		if (!BoolFromBoolean( zone, valid )) break;
+		items[taken++] = METHOD_0( iterator, sym_current );
+		iterator = METHOD_0( iterator, sym_next );
+		if (IsAnException( iterator )) break;
+	}
+	return MakeBatch( zone, items, taken, iterator );
+}
+
+value_t NextBatch( zone_t zone, value_t iterator, size_t count )
+{
+	if (IsAnException( iterator )) return iterator;
+	value_t method = CALL_1( iterator, sym_next_n );
+	if (IsAnException( method )) {
+		return StepBatch( zone, iterator, count );
+	}
+	return CALL_2( method, iterator, NumberFromInt( zone, count ) );
+}
+
+static value_t MakeBatchIterator(
+		zone_t zone, value_t items, value_t index, value_t rest )
+{
+	struct closure *out =
+			ALLOC( Batch_iterator_function, BATCH_ITERATOR_SLOT_COUNT );
+	out->slots[BATCH_ITERATOR_ITEMS_SLOT] = items;
+	out->slots[BATCH_ITERATOR_INDEX_SLOT] = index;
+	out->slots[BATCH_ITERATOR_REST_SLOT] = rest;
+	return out;
+}
+
+static value_t FillBatchIterator( zone_t zone, value_t source )
+{
+	// An iterator which cannot hand over a batch of its own would only be
+	// stepped through one element at a time anyway, so we get out of the way
+	// and let the caller use it directly.
+	if (IsAnException( source )) return source;
+	value_t method = CALL_1( source, sym_next_n );
+	if (IsAnException( method )) return source;
+	value_t count = NumberFromInt( zone, BATCH_ITERATOR_COUNT );
+	value_t batch = CALL_2( method, source, count );
+	if (IsAnException( batch )) return batch;
+	return MakeBatchIterator(
+			zone, TupleItem( batch, 0 ), num_zero, TupleItem( batch, 1 ) );
+}
+
+value_t ResumeBatch( zone_t zone, value_t items, size_t index, value_t rest )
+{
+	assert( index < TupleSize( items ) );
+	return MakeBatchIterator( zone, items, NumberFromInt( zone, index ), rest );
+}
+
+static value_t Batch_iterator_is_valid( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t items = iterator->slots[BATCH_ITERATOR_ITEMS_SLOT];
+	int index = IntFromFixint( iterator->slots[BATCH_ITERATOR_INDEX_SLOT] );
+	return BooleanFromBool( (size_t)index < TupleSize( items ) );
+}
+
+static value_t Batch_iterator_current( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t items = iterator->slots[BATCH_ITERATOR_ITEMS_SLOT];
+	int index = IntFromFixint( iterator->slots[BATCH_ITERATOR_INDEX_SLOT] );
+	if ((size_t)index >= TupleSize( items )) {
+		return ThrowCStr( zone, "the iterator is not valid" );
+	}
+	return TupleItem( items, index );
+}
+
+static value_t Batch_iterator_next( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	value_t items = iterator->slots[BATCH_ITERATOR_ITEMS_SLOT];
+	value_t rest = iterator->slots[BATCH_ITERATOR_REST_SLOT];
+	size_t index = IntFromFixint( iterator->slots[BATCH_ITERATOR_INDEX_SLOT] );
+	size_t size = TupleSize( items );
+	if (index >= size) {
+		return ThrowCStr( zone, "the iterator is not valid" );
+	}
+	if (index + 1 < size) {
+		value_t next = NumberFromInt( zone, index + 1 );
+		return MakeBatchIterator( zone, items, next, rest );
+	}
+	return FillBatchIterator( zone, rest );
+}
+
+static value_t Batch_iterator_next_n(
+		PREFUNC, value_t iterator, value_t count )
+{
+	ARGCHECK_2( iterator, count );
+	size_t limit = 0;
+	if (!BatchCount( count, &limit )) {
+		return ThrowCStr( zone, "batch count must be an integer" );
+	}
+	value_t items = iterator->slots[BATCH_ITERATOR_ITEMS_SLOT];
+	value_t rest = iterator->slots[BATCH_ITERATOR_REST_SLOT];
+	size_t index = IntFromFixint( iterator->slots[BATCH_ITERATOR_INDEX_SLOT] );
+	size_t size = TupleSize( items );
+	if (0 == index && size <= limit) {
+		return AllocPair( zone, items, rest );
+	}
+	value_t head[BATCH_LIMIT];
+	size_t taken = 0;
+	while (taken < limit && index < size) {
+		head[taken++] = TupleItem( items, index++ );
+	}
+	if (index < size) {
+		value_t next = NumberFromInt( zone, index );
+		rest = MakeBatchIterator( zone, items, next, rest );
+	}
+	return MakeBatch( zone, head, taken, rest );
+}
+
+static const struct method_table Batch_iterator_methods = {
+	(function_t)Batch_iterator_function,
+	{
+		METHOD_ENTRY(is_valid, Batch_iterator_is_valid),
+		METHOD_ENTRY(current, Batch_iterator_current),
+		METHOD_ENTRY(next, Batch_iterator_next),
+		METHOD_ENTRY(next_n, Batch_iterator_next_n),
+	}
+};
+
+static value_t Batch_iterator_function( PREFUNC, value_t selector )
+{
+	ARGCHECK_1( selector );
+	DISPATCH_METHODS( Batch_iterator_methods );
+	return ThrowMemberNotFound( zone, selector );
+}
+
+static value_t next_batch_function( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	// A for loop calls this once its iterator is known to be valid, and only
+	// if has_batches said the loop's first iterator had a next_n method. The
+	// iterator a batch leaves behind may not have one, though; in that case
+	// we step it once, so that we never evaluate a lazy sequence further
+	// ahead than the loop has asked for. The loop wants the element count
+	// too, which saves it from sending the batch a size message.
+	value_t method = CALL_1( iterator, sym_next_n );
+	value_t batch = NULL;
+	if (IsAnException( method )) {
+		batch = StepBatch( zone, iterator, 1 );
+	} else {
+		value_t count = NumberFromInt( zone, BATCH_ITERATOR_COUNT );
+		batch = CALL_2( method, iterator, count );
+	}
+	if (IsAnException( batch )) return batch;
+	if (0 == TupleSize( TupleItem( batch, 0 ) )) {
+		// The iterator is valid, so there is at least one more element, even
+		// if its next_n declined to hand it over.
+		batch = StepBatch( zone, iterator, 1 );
+		if (IsAnException( batch )) return batch;
+	}
+	value_t items = TupleItem( batch, 0 );
+	value_t parts[3] = {
+		items,
+		NumberFromInt( zone, TupleSize( items ) ),
+		TupleItem( batch, 1 )
+	};
+	return TupleFromArray( zone, parts, 3 );
+}
+const struct closure next_batch = {(function_t)next_batch_function};
+
+static value_t has_batches_function( PREFUNC, value_t iterator )
+{
+	ARGCHECK_1( iterator );
+	// Taking one element per batch would only cost the loop more than
+	// stepping the iterator itself, so the loop asks this once, on entry, and
+	// batches only if the answer is yes.
+	value_t method = CALL_1( iterator, sym_next_n );
+	return BooleanFromBool( !IsAnException( method ) );
+}
+const struct closure has_batches = {(function_t)has_batches_function};
@@ -0,0 +1,73 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+
+#ifndef sequences_h
+#define sequences_h
+
+#include <stdbool.h>
+#include "closures.h"
+
+// Any sequence may be walked with an iterator. A random-access sequence also
+// knows its size, can look an element up by index, and can cut out a slice
+// of itself, with slice(skip, count) taking up to 'count' elements after the
+// first 'skip'. Slices clamp their bounds to the sequence, the way taking
+// from a dropped sequence would.
+bool IsRandomAccess( zone_t zone, value_t seq );
+
+// Clamp a pair of slice arguments to a sequence of the given size, producing
+// the index range [begin, end). Returns false if the arguments are not
+// integers.
+bool SliceBounds(
+		value_t skip, value_t count, size_t size, size_t *begin, size_t *end );
+
+// Walk a random-access sequence by index. The iterator's next method is
+// trivial; all the work happens when someone asks for the current element.
+value_t IndexIterator( zone_t zone, value_t seq );
+
+// An iterator may also hand over several elements at once: next_n(count)
+// returns a pair holding a tuple of up to 'count' elements and an iterator
+// positioned after the last of them. The tuple may be shorter than asked for,
+// even when more elements remain, but it is empty only if the iterator was
+// not valid. No batch ever holds more than BATCH_LIMIT elements.
+#define BATCH_LIMIT 256
+value_t NextBatch( zone_t zone, value_t iterator, size_t count );
+value_t MakeBatch(
+		zone_t zone, const value_t *items, size_t count, value_t rest );
+bool BatchCount( value_t count, size_t *out );
+
+// An iterator over the items of a batch tuple from 'index' on, followed by
+// the elements of the 'rest' iterator. The index must lie within the tuple.
+value_t ResumeBatch( zone_t zone, value_t items, size_t index, value_t rest );
+
+// Builtin entrypoint a for loop calls to take its next batch of elements. It
+// returns a tuple of the batch, the number of elements in it, and the
+// iterator positioned after them; the loop walks the batch by index and only
+// calls back into the iterator once the batch is used up. An iterator without
+// next_n gives up one element at a time.
+extern const struct closure next_batch;
+
+// Builtin entrypoint a for loop calls before it starts, to find out whether
+// its iterator has a next_n method; if not, the loop steps the iterator
+// itself instead of taking batches.
+extern const struct closure has_batches;
+
+#endif //sequences_h
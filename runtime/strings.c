@@ -20,12 +20,14 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 #include "strings.h"
 #include "atoms/numbers.h"
 #include "atoms/booleans.h"
 #include "atoms/symbols.h"
 #include "atoms/fixints.h"
 #include "atoms/stringliterals.h"
+#include "dispatch.h"
 #include "macros.h"
 #include "buffer.h"
 #include "exceptions.h"
@@ -45,10 +47,15 @@
 // new one, and it'll perform better if you use the built in tool, so perhaps
 // people will simply choose to use it instead of writing their own.
 
-#define STRING_CAT_SLOT_COUNT 3
+// Each cat node also caches the number of chars in the whole subtree, so that
+// length, slice, and lookup can find their way down the tree without walking
+// it. If one of the branches is some string-like sequence we don't know how
+// to measure, the length slot is null.
+#define STRING_CAT_SLOT_COUNT 4
 #define STRING_CAT_LEVEL_SLOT 0
 #define STRING_CAT_LEFT_SLOT 1
 #define STRING_CAT_RIGHT_SLOT 2
+#define STRING_CAT_LENGTH_SLOT 3
 
 #define STRING_CAT_ITER_SLOT_COUNT 2
 #define STRING_CAT_ITER_CURRENT_SLOT 0
@@ -92,14 +99,19 @@ static value_t String_Cat_iterator_next( PREFUNC, value_t iter )
 	}
 }
 
+static const struct method_table String_Cat_iterator_methods = {
+	(function_t)String_Cat_iterator_function,
+	{
+		METHOD_ENTRY(current, String_Cat_iterator_current),
+		METHOD_ENTRY(next, String_Cat_iterator_next),
+		METHOD_CLOSURE(is_valid, &True_returner),
+	}
+};
+
 static value_t String_Cat_iterator_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(current, String_Cat_iterator_current);
-	DEFINE_METHOD(next, String_Cat_iterator_next);
-	if (sym_is_valid == selector) {
-		return &True_returner;
-	}
+	DISPATCH_METHODS( String_Cat_iterator_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
@@ -143,12 +155,41 @@ static value_t String_Cat_concatenate( PREFUNC, value_t left, value_t right )
 	return ConcatStrings( zone, left, right );
 }
 
+static value_t String_Cat_length( PREFUNC, value_t str_obj )
+{
+	ARGCHECK_1( str_obj );
+	return StringLength( zone, str_obj );
+}
+
+static value_t String_Cat_slice(
+		PREFUNC, value_t str_obj, value_t skip, value_t count )
+{
+	ARGCHECK_3( str_obj, skip, count );
+	return SliceString( zone, str_obj, skip, count );
+}
+
+static value_t String_Cat_lookup( PREFUNC, value_t str_obj, value_t index )
+{
+	ARGCHECK_2( str_obj, index );
+	return LookupString( zone, str_obj, index );
+}
+
+static const struct method_table String_Cat_methods = {
+	(function_t)String_Cat_function,
+	{
+		METHOD_ENTRY(iterate, String_Cat_iterate),
+		METHOD_ENTRY(compare_to, String_Cat_compare_to),
+		METHOD_ENTRY(concatenate, String_Cat_concatenate),
+		METHOD_ENTRY(length, String_Cat_length),
+		METHOD_ENTRY(slice, String_Cat_slice),
+		METHOD_ENTRY(lookup, String_Cat_lookup),
+	}
+};
+
 static value_t String_Cat_function( PREFUNC, value_t selector )
 {
 	ARGCHECK_1( selector );
-	DEFINE_METHOD(iterate, String_Cat_iterate)
-	DEFINE_METHOD(compare_to, String_Cat_compare_to)
-	DEFINE_METHOD(concatenate, String_Cat_concatenate)
+	DISPATCH_METHODS( String_Cat_methods );
 	return ThrowMemberNotFound( zone, selector );
 }
 
@@ -164,17 +205,29 @@ static value_t String_Cat_function( PREFUNC, value_t selector )
 // grow enough that further concatenation will result in a concat node object.
 static bool ShouldUseBruteForceConcat( value_t left, value_t right )
 {
-	if (!IsAStringLiteral( left )) return false;
-	if (!IsAStringLiteral( right )) return false;
+	const byte_t *left_bytes = NULL;
+	const byte_t *right_bytes = NULL;
+	size_t left_size = 0;
+	size_t right_size = 0;
+	if (!StringBytes( left, &left_bytes, &left_size )) return false;
+	if (!StringBytes( right, &right_bytes, &right_size )) return false;
 	const size_t kMagicArbitraryThreshold = 32;
-	// We assume here that string literals are always implemented as buffers.
-	// If that assumption ever changed, this code would break.
-	if (BUFFER(left)->size >= kMagicArbitraryThreshold) return false;
-	if (BUFFER(right)->size >= kMagicArbitraryThreshold) return false;
+	if (left_size >= kMagicArbitraryThreshold) return false;
+	if (right_size >= kMagicArbitraryThreshold) return false;
 	// Survived all the checks? Then we'd better use the brute force option.
 	return true;
 }
 
+static bool KnownCodepoints( value_t node, size_t *codepoints )
+{
+	if (StringCodepoints( node, codepoints )) return true;
+	if (IsAStringCat( node ) && node->slots[STRING_CAT_LENGTH_SLOT]) {
+		*codepoints = IntFromFixint( node->slots[STRING_CAT_LENGTH_SLOT] );
+		return true;
+	}
+	return false;
+}
+
 static int ConcatNodeLevel( value_t node )
 {
 	if (IsAStringCat( node )) {
@@ -268,9 +321,217 @@ value_t ConcatStrings( zone_t zone, value_t left, value_t right )
 	out->slots[STRING_CAT_LEVEL_SLOT] = NumberFromInt( zone, newlevel );
 	out->slots[STRING_CAT_LEFT_SLOT] = left;
 	out->slots[STRING_CAT_RIGHT_SLOT] = right;
+	size_t leftcount = 0;
+	size_t rightcount = 0;
+	if (KnownCodepoints( left, &leftcount ) &&
+			KnownCodepoints( right, &rightcount )) {
+		out->slots[STRING_CAT_LENGTH_SLOT] =
+				NumberFromInt( zone, leftcount + rightcount );
+	}
 	return (value_t)out;
 }
 
+static void PushPendingChunk( struct string_chunks *chunks, value_t node )
+{
+	// Most concatenation trees are shallow, or lean to the right, so the
+	// inline stack is almost always enough; if it is not, we move the pending
+	// list out onto the heap and keep doubling it.
+	if (chunks->depth == chunks->capacity) {
+		size_t capacity = chunks->capacity * 2;
+		value_t *pending = malloc( capacity * sizeof(value_t) );
+		memcpy( pending, chunks->pending, chunks->depth * sizeof(value_t) );
+		if (chunks->pending != chunks->stack) {
+			free( chunks->pending );
+		}
+		chunks->pending = pending;
+		chunks->capacity = capacity;
+	}
+	chunks->pending[chunks->depth++] = node;
+}
+
+size_t EncodeUTF8( int ch, byte_t *dest )
+{
+	// Write the codepoint into the destination, which must have room for at
+	// least four bytes. Return the number of bytes used, or zero if the value
+	// is not a legal codepoint.
+	if (ch < 0) {
+		return 0;
+	} else if (ch <= 0x00007F) {
+		dest[0] = (byte_t)ch;
+		return 1;
+	} else if (ch <= 0x0007FF) {
+		dest[0] = (0xC0 | ((ch >> 6) & 0x1F));
+		dest[1] = (0x80 | (ch & 0x3F));
+		return 2;
+	} else if (ch <= 0x00FFFF) {
+		dest[0] = (0xE0 | ((ch >> 12) & 0x0F));
+		dest[1] = (0x80 | ((ch >> 6) & 0x3F));
+		dest[2] = (0x80 | (ch & 0x3F));
+		return 3;
+	} else if (ch <= 0x10FFFF) {
+		dest[0] = (0xF0 | ((ch >> 18) & 0x07));
+		dest[1] = (0x80 | ((ch >> 12) & 0x3F));
+		dest[2] = (0x80 | ((ch >> 6) & 0x3F));
+		dest[3] = (0x80 | (ch & 0x3F));
+		return 4;
+	}
+	return 0;
+}
+
+bool DecodeUTF8Sequence(
+		const byte_t *src, size_t avail, size_t *consumed, int *ch )
+{
+	// Decode one char, following the well-formed byte sequence table in the
+	// Unicode standard, which rules out overlong forms, surrogates, and values
+	// past U+10FFFF. On failure, consume the maximal invalid subpart - the
+	// lead byte plus whatever continuation bytes were acceptable so far - so
+	// that it can be replaced by a single U+FFFD.
+	byte_t lead = src[0];
+	byte_t lo = 0x80, hi = 0xBF;
+	size_t need = 0;
+	int out = 0;
+	*consumed = 1;
+	*ch = 0xFFFD;
+	if (lead < 0x80) {
+		*ch = lead;
+		return true;
+	} else if (lead >= 0xC2 && lead <= 0xDF) {
+		need = 1;
+		out = lead & 0x1F;
+	} else if (lead >= 0xE0 && lead <= 0xEF) {
+		need = 2;
+		out = lead & 0x0F;
+		if (0xE0 == lead) lo = 0xA0;
+		if (0xED == lead) hi = 0x9F;
+	} else if (lead >= 0xF0 && lead <= 0xF4) {
+		need = 3;
+		out = lead & 0x07;
+		if (0xF0 == lead) lo = 0x90;
+		if (0xF4 == lead) hi = 0x8F;
+	} else {
+		return false;
+	}
+	for (size_t i = 1; i <= need; i++) {
+		if (i >= avail || src[i] < lo || src[i] > hi) {
+			return false;
+		}
+		out = (out << 6) | (src[i] & 0x3F);
+		lo = 0x80;
+		hi = 0xBF;
+		*consumed = i + 1;
+	}
+	*ch = out;
+	return true;
+}
+
+static size_t EncodeSequenceChunk( zone_t zone, struct string_chunks *chunks )
+{
+	// This piece of the string is some sequence we know nothing about, so we
+	// have to walk it the slow way. Pull codepoints from its iterator and pack
+	// them into the scratch buffer until it fills up or the sequence ends.
+	value_t iter = chunks->iter;
+	size_t used = 0;
+	while (used + 4 <= STRING_CHUNK_SCRATCH_SIZE) {
+		value_t is_valid = METHOD_0( iter, sym_is_valid );
+		if (IsAnException( is_valid )) {
+			chunks->error = is_valid;
+			break;
+		}
+		if (!BoolFromBoolean( zone, is_valid )) {
+			iter = NULL;
+			break;
+		}
+		value_t current = METHOD_0( iter, sym_current );
+		if (IsAnException( current )) {
+			chunks->error = current;
+			break;
+		}
+		if (!IsAFixint( current )) {
+			chunks->error = ThrowCStr( zone, "string element is not a char" );
+			break;
+		}
+		size_t count = EncodeUTF8(
+				IntFromFixint( current ), &chunks->scratch[used] );
+		if (0 == count) {
+			chunks->error = ThrowCStr( zone, "string element is not a char" );
+			break;
+		}
+		used += count;
+		iter = METHOD_0( iter, sym_next );
+		if (IsAnException( iter )) {
+			chunks->error = iter;
+			break;
+		}
+	}
+	chunks->iter = chunks->error ? NULL : iter;
+	return used;
+}
+
+void BeginStringChunks( struct string_chunks *chunks, value_t str )
+{
+	chunks->pending = chunks->stack;
+	chunks->depth = 0;
+	chunks->capacity = STRING_CHUNK_STACK_DEPTH;
+	chunks->iter = NULL;
+	chunks->error = NULL;
+	if (str) {
+		PushPendingChunk( chunks, str );
+	}
+}
+
+bool NextStringChunk(
+		zone_t zone,
+		struct string_chunks *chunks,
+		const byte_t **bytes,
+		size_t *length )
+{
+	// Walk the concatenation tree from left to right, using our pending stack
+	// in place of recursion. Literal leaves hand back their own buffers, so
+	// the common case never copies anything. We never return an empty chunk.
+	while (!chunks->error) {
+		if (chunks->iter) {
+			size_t used = EncodeSequenceChunk( zone, chunks );
+			if (used > 0 && !chunks->error) {
+				*bytes = chunks->scratch;
+				*length = used;
+				return true;
+			}
+			continue;
+		}
+		if (0 == chunks->depth) {
+			break;
+		}
+		value_t node = chunks->pending[--chunks->depth];
+		if (IsAStringCat( node )) {
+			// The right branch waits on the stack while we visit the left.
+			PushPendingChunk( chunks, node->slots[STRING_CAT_RIGHT_SLOT] );
+			PushPendingChunk( chunks, node->slots[STRING_CAT_LEFT_SLOT] );
+		} else if (StringBytes( node, bytes, length )) {
+			if (*length > 0) {
+				return true;
+			}
+		} else {
+			value_t iter = METHOD_0( node, sym_iterate );
+			if (IsAnException( iter )) {
+				chunks->error = iter;
+			} else {
+				chunks->iter = iter;
+			}
+		}
+	}
+	return false;
+}
+
+void EndStringChunks( struct string_chunks *chunks )
+{
+	if (chunks->pending != chunks->stack) {
+		free( chunks->pending );
+	}
+	chunks->pending = chunks->stack;
+	chunks->depth = 0;
+	chunks->iter = NULL;
+}
+
 value_t CompareStrings( zone_t zone, value_t left, value_t right )
 {
 	// Discover an ordering relationship between these strings.
@@ -279,43 +540,58 @@ value_t CompareStrings( zone_t zone, value_t left, value_t right )
 	// Simple ordinal comparison. Users must handle issues of normalization and
 	// case folding themselves. This just compares codepoints. Useful for
 	// storing strings in maps, among other things.
-	value_t l_iter = METHOD_0( left, sym_iterate );
-	value_t r_iter = METHOD_0( right, sym_iterate );
-
-	while (true) {
-		value_t l_is_valid_obj = METHOD_0( l_iter, sym_is_valid );
-		if (IsAnException( l_is_valid_obj )) return l_is_valid_obj;
-		value_t r_is_valid_obj = METHOD_0( r_iter, sym_is_valid );
-		if (IsAnException( r_is_valid_obj )) return r_is_valid_obj;
-		bool l_valid = BoolFromBoolean( zone, l_is_valid_obj );
-		bool r_valid = BoolFromBoolean( zone, r_is_valid_obj );
-
-		if (l_valid && r_valid) {
-			value_t l_char_obj = METHOD_0( l_iter, sym_current );
-			if (IsAnException( l_char_obj )) return l_char_obj;
-			if (!IsAFixint( l_char_obj )) {
-				return ThrowCStr( zone, "left operand is not a string" );
-			}
-			value_t r_char_obj = METHOD_0( r_iter, sym_current );
-			if (IsAnException( r_char_obj )) return r_char_obj;
-			if (!IsAFixint( r_char_obj )) {
-				return ThrowCStr( zone, "right operand is not a string" );
-			}
-
-			int l_char = IntFromFixint( l_char_obj );
-			int r_char = IntFromFixint( r_char_obj );
-			if (l_char < r_char) return LessThan();
-			if (l_char > r_char) return GreaterThan();
+	// UTF-8 was designed so that a bytewise comparison of two well-formed
+	// strings gives the same answer as a comparison of their codepoints, so we
+	// can compare the strings a chunk at a time and let memcmp do the work.
+	if (left == right) return EqualTo();
+	struct string_chunks l_chunks;
+	struct string_chunks r_chunks;
+	BeginStringChunks( &l_chunks, left );
+	BeginStringChunks( &r_chunks, right );
 
-			l_iter = METHOD_0( l_iter, sym_next );
-			r_iter = METHOD_0( r_iter, sym_next );
+	const byte_t *l_bytes = NULL;
+	const byte_t *r_bytes = NULL;
+	size_t l_length = 0;
+	size_t r_length = 0;
+	bool l_valid = true;
+	bool r_valid = true;
+	value_t out = NULL;
+	while (!out) {
+		// Refill whichever side has run out of bytes in its current chunk.
+		// The chunk boundaries of the two strings need not line up.
+		if (0 == l_length) {
+			l_valid = NextStringChunk( zone, &l_chunks, &l_bytes, &l_length );
+		}
+		if (0 == r_length) {
+			r_valid = NextStringChunk( zone, &r_chunks, &r_bytes, &r_length );
+		}
+		if (l_chunks.error) {
+			out = l_chunks.error;
+		} else if (r_chunks.error) {
+			out = r_chunks.error;
+		} else if (l_valid && r_valid) {
+			size_t span = (l_length < r_length) ? l_length : r_length;
+			int relation = memcmp( l_bytes, r_bytes, span );
+			if (relation < 0) {
+				out = LessThan();
+			} else if (relation > 0) {
+				out = GreaterThan();
+			}
+			l_bytes += span;
+			l_length -= span;
+			r_bytes += span;
+			r_length -= span;
+		} else if (r_valid) {
+			out = LessThan();
+		} else if (l_valid) {
+			out = GreaterThan();
 		} else {
-			if (r_valid && !l_valid) return LessThan();
-			if (l_valid && !r_valid) return GreaterThan();
-			break;
+			out = EqualTo();
 		}
 	}
-	return EqualTo();
+	EndStringChunks( &l_chunks );
+	EndStringChunks( &r_chunks );
+	return out;
 }
 
 static void BufUp( char **buffer, size_t *size, unsigned endex )
@@ -335,55 +611,204 @@ static void BufUp( char **buffer, size_t *size, unsigned endex )
 const char *UnpackString( zone_t zone, value_t it )
 {
 	if (!it) return NULL;
-	value_t iter = METHOD_0( it, sym_iterate );
-	if (IsAnException( iter )) return NULL;
 
 	// Create the initial buffer, just large enough to hold the terminator.
 	// We will resize this unless we find no characters.
 	size_t size = 1;
 	char *buffer = malloc(size);
-	unsigned i = 0;
+	size_t i = 0;
 
-	while (BoolFromBoolean( zone, METHOD_0( iter, sym_is_valid ) )) {
-		value_t current = METHOD_0( iter, sym_current );
-		if (IsAnException( iter )) goto error;
-		if (!IsAFixint( current )) goto error;
-
-		// Unpack the current character into the output buffer, reallocating
-		// it if necessary to ensure that we have enough space.
-		int ch = IntFromFixint( current );
-		if (ch <= 0x00007F) {
-			BufUp( &buffer, &size, i + 1 );
-			buffer[i++] = (char)(ch & 0xFF);
-		} else if (ch >= 0x000080 && ch <= 0x0007FF) {
-			BufUp( &buffer, &size, i + 2 );
-			buffer[i++] = (0xC0 | ((ch >> 6) & 0x1F));
-			buffer[i++] = (0x80 | (ch & 0x3F));
-		} else if (ch >= 0x000800 && ch <= 0x00FFFF) {
-			BufUp( &buffer, &size, i + 3 );
-			buffer[i++] = (0xE0 | ((ch >> 12) & 0x0F));
-			buffer[i++] = (0x80 | ((ch >> 6) & 0x3F));
-			buffer[i++] = (0x80 | ((ch & 0x3F)));
-		} else if (ch >= 0x010000 && ch <= 0x10FFFF) {
-			BufUp( &buffer, &size, i + 4 );
-			buffer[i++] = (0xF0 | ((ch >> 18) & 0x07));
-			buffer[i++] = (0x80 | ((ch >> 12) & 0x3F));
-			buffer[i++] = (0x80 | ((ch >> 6) & 0x3F));
-			buffer[i++] = (0x80 | (ch & 0x3F));
-		} else {
-			goto error;
-		}
-
-		iter = METHOD_0( iter, sym_next );
-		if (IsAnException( iter )) goto error;
+	// Copy the string over one chunk at a time. For a string literal there is
+	// only one chunk, so this is a single memcpy.
+	struct string_chunks chunks;
+	BeginStringChunks( &chunks, it );
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	while (NextStringChunk( zone, &chunks, &bytes, &length )) {
+		BufUp( &buffer, &size, i + length );
+		memcpy( &buffer[i], bytes, length );
+		i += length;
+	}
+	bool failed = (NULL != chunks.error);
+	EndStringChunks( &chunks );
+	if (failed) {
+		free( buffer );
+		return NULL;
 	}
 
 	// Write a terminator into the buffer and return it.
 	BufUp( &buffer, &size, i + 1 );
 	buffer[i++] = '\0';
 	return buffer;
+}
+
+static value_t CountChunkCodepoints(
+		zone_t zone, value_t str, size_t *codepoints )
+{
+	// This string contains something we can't measure without looking, so
+	// walk its chunks and count the chars. Return an exception if the walk
+	// fails, or null if we got a count.
+	struct string_chunks chunks;
+	BeginStringChunks( &chunks, str );
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	size_t count = 0;
+	while (NextStringChunk( zone, &chunks, &bytes, &length )) {
+		for (size_t i = 0; i < length; i += UTF8SequenceLength( bytes[i] )) {
+			count++;
+		}
+	}
+	value_t error = chunks.error;
+	EndStringChunks( &chunks );
+	*codepoints = count;
+	return error;
+}
 
-error:
+static value_t SliceChunks(
+		zone_t zone, value_t str, size_t skip, size_t count )
+{
+	// Slow path for strings of unknown length: walk the chunks, copying out
+	// the run of bytes which falls within the range into a new literal.
+	struct string_chunks chunks;
+	BeginStringChunks( &chunks, str );
+	size_t size = 1;
+	char *buffer = malloc( size );
+	size_t used = 0;
+	size_t index = 0;
+	size_t limit = skip + count;
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	while (index < limit && NextStringChunk( zone, &chunks, &bytes, &length )) {
+		size_t i = 0;
+		while (i < length && index < skip) {
+			i += UTF8SequenceLength( bytes[i] );
+			index++;
+		}
+		size_t run = i;
+		while (i < length && index < limit) {
+			i += UTF8SequenceLength( bytes[i] );
+			index++;
+		}
+		if (i > length) {
+			i = length;
+		}
+		if (i > run) {
+			BufUp( &buffer, &size, used + (i - run) );
+			memcpy( &buffer[used], &bytes[run], i - run );
+			used += i - run;
+		}
+	}
+	value_t out = chunks.error;
+	EndStringChunks( &chunks );
+	if (!out) {
+		out = StringFromUTF8Bytes( zone, buffer, used );
+	}
 	free( buffer );
-	return NULL;
+	return out;
+}
+
+static value_t SliceKnown( zone_t zone, value_t str, size_t skip, size_t count )
+{
+	// The string knows its own length, and the caller has already clamped the
+	// range to fit inside it. Descend the concatenation tree, slicing only the
+	// branches which overlap the range, and join the pieces back together.
+	size_t total = 0;
+	bool known = KnownCodepoints( str, &total );
+	assert( known && skip + count <= total );
+	(void)known;
+	if (0 == skip && count == total) {
+		return str;
+	}
+	if (0 == count) {
+		return StringFromUTF8Bytes( zone, "", 0 );
+	}
+	if (!IsAStringCat( str )) {
+		return SliceContiguousString( zone, str, skip, count );
+	}
+	value_t left = str->slots[STRING_CAT_LEFT_SLOT];
+	value_t right = str->slots[STRING_CAT_RIGHT_SLOT];
+	size_t leftcount = 0;
+	KnownCodepoints( left, &leftcount );
+	if (skip + count <= leftcount) {
+		return SliceKnown( zone, left, skip, count );
+	}
+	if (skip >= leftcount) {
+		return SliceKnown( zone, right, skip - leftcount, count );
+	}
+	size_t headcount = leftcount - skip;
+	value_t head = SliceKnown( zone, left, skip, headcount );
+	value_t tail = SliceKnown( zone, right, 0, count - headcount );
+	return ConcatStrings( zone, head, tail );
+}
+
+value_t StringLength( zone_t zone, value_t str )
+{
+	size_t codepoints = 0;
+	if (!KnownCodepoints( str, &codepoints )) {
+		value_t error = CountChunkCodepoints( zone, str, &codepoints );
+		if (error) return error;
+	}
+	return NumberFromInt( zone, codepoints );
+}
+
+value_t SliceString( zone_t zone, value_t str, value_t skip, value_t count )
+{
+	// Return the run of chars beginning at index 'skip' and continuing for
+	// 'count' chars, or to the end of the string if it is shorter. This
+	// matches the behavior of taking from a dropped sequence, so negative
+	// bounds simply count as zero.
+	if (!IsAFixint( skip ) || !IsAFixint( count )) {
+		return ThrowCStr( zone, "slice bounds must be integers" );
+	}
+	int skip_val = IntFromFixint( skip );
+	int count_val = IntFromFixint( count );
+	size_t begin = (skip_val > 0) ? skip_val : 0;
+	size_t length = (count_val > 0) ? count_val : 0;
+	size_t available = 0;
+	if (!KnownCodepoints( str, &available )) {
+		return SliceChunks( zone, str, begin, length );
+	}
+	if (begin > available) {
+		begin = available;
+	}
+	if (length > available - begin) {
+		length = available - begin;
+	}
+	return SliceKnown( zone, str, begin, length );
+}
+
+value_t LookupString( zone_t zone, value_t str, value_t index )
+{
+	// Return the char at this index, as a number.
+	if (!IsAFixint( index )) {
+		return ThrowCStr( zone, "element index is not an integer" );
+	}
+	int index_val = IntFromFixint( index );
+	if (index_val < 0) {
+		return ThrowCStr( zone, "element index is out of bounds" );
+	}
+	size_t available = 0;
+	if (!KnownCodepoints( str, &available )) {
+		str = SliceChunks( zone, str, index_val, 1 );
+		if (IsAnException( str )) return str;
+		index_val = 0;
+		KnownCodepoints( str, &available );
+	}
+	if ((size_t)index_val >= available) {
+		return ThrowCStr( zone, "element index is out of bounds" );
+	}
+	// Find the leaf which contains the char we want.
+	size_t offset = index_val;
+	while (IsAStringCat( str )) {
+		value_t left = str->slots[STRING_CAT_LEFT_SLOT];
+		size_t leftcount = 0;
+		KnownCodepoints( left, &leftcount );
+		if (offset < leftcount) {
+			str = left;
+		} else {
+			offset -= leftcount;
+			str = str->slots[STRING_CAT_RIGHT_SLOT];
+		}
+	}
+	return LookupContiguousString( zone, str, offset );
 }
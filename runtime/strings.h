@@ -23,10 +23,19 @@
 #define strings_h
 
 #include "closures.h"
+#include <stdbool.h>
 
 value_t ConcatStrings( zone_t zone, value_t left, value_t right );
 value_t CompareStrings( zone_t zone, value_t left, value_t right );
 
+// Native implementations of the string length, slice, and lookup methods.
+// Literals, slices, and concatenations of them know their own lengths, so
+// these run in constant time on ASCII literals and logarithmic time on
+// concatenation trees. Anything else is measured by walking its chunks.
+value_t StringLength( zone_t zone, value_t str );
+value_t SliceString( zone_t zone, value_t str, value_t skip, value_t count );
+value_t LookupString( zone_t zone, value_t str, value_t index );
+
 // Unpack a sequence of Unicode characters into a zero-terminated, C-style
 // string using UTF-8 encoding. It will malloc a buffer, so you must make sure
 // to free() it when you are done. After this operation is complete, the buffer
@@ -37,4 +46,46 @@ value_t CompareStrings( zone_t zone, value_t left, value_t right );
 // will return a minimally sized buffer whose zero'th byte is zero.
 const char *UnpackString( zone_t zone, value_t it );
 
+// Write a codepoint as UTF-8 into a destination with room for at least four
+// bytes. Returns the number of bytes used, or zero if the value is not a legal
+// codepoint.
+size_t EncodeUTF8( int ch, byte_t *dest );
+
+// Decode one UTF-8 char, strictly: overlong forms, surrogates, and values past
+// U+10FFFF are malformed. On success, returns true and reports the number of
+// bytes used. On failure, sets the char to U+FFFD and reports the length of
+// the maximal invalid subpart, which should be replaced by that one U+FFFD.
+bool DecodeUTF8Sequence(
+		const byte_t *src, size_t avail, size_t *consumed, int *ch );
+
+// String chunks let runtime code work on strings as a series of contiguous
+// UTF-8 byte spans rather than one boxed codepoint at a time. String literals
+// yield their own buffer, concatenation nodes yield the chunks of each branch
+// in order, and any other sequence of codepoints is encoded into the scratch
+// buffer a few kilobytes at a time. Each span is only valid until the next
+// call to NextStringChunk. The cursor lives on the caller's stack; you must
+// call EndStringChunks when you are done, since deep concatenation trees may
+// force it to grow its node stack on the heap. If the string turns out to be
+// malformed, NextStringChunk will return false and leave an exception in the
+// cursor's error field.
+#define STRING_CHUNK_STACK_DEPTH 32
+#define STRING_CHUNK_SCRATCH_SIZE 4096
+struct string_chunks
+{
+	value_t *pending;
+	size_t depth;
+	size_t capacity;
+	value_t iter;
+	value_t error;
+	value_t stack[STRING_CHUNK_STACK_DEPTH];
+	byte_t scratch[STRING_CHUNK_SCRATCH_SIZE];
+};
+void BeginStringChunks( struct string_chunks *chunks, value_t str );
+bool NextStringChunk(
+		zone_t zone,
+		struct string_chunks *chunks,
+		const byte_t **bytes,
+		size_t *length );
+void EndStringChunks( struct string_chunks *chunks );
+
 #endif //strings_h
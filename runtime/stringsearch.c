@@ -0,0 +1,226 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+// memmem is an extension, so we have to ask for it.
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include "stringsearch.h"
+#include "strings.h"
+#include "atoms/numbers.h"
+#include "atoms/symbols.h"
+#include "atoms/stringliterals.h"
+#include "containers/list-empty.h"
+#include "macros.h"
+#include "exceptions.h"
+
+
+// The library used to implement these functions in Radian, pulling one boxed
+// char at a time out of the string's iterator. Here we search the UTF-8 bytes
+// directly instead. A UTF-8 encoded needle can only match a haystack at a char
+// boundary, so a plain byte search finds exactly the matches a char-by-char
+// search would, and every offset it returns is safe to slice at.
+
+static value_t ContiguousString( zone_t zone, value_t str )
+{
+	// Literals and slices already keep their bytes in one run. Anything else,
+	// concatenation trees included, we flatten into a new literal once, and
+	// the results of the search will share that literal's buffer.
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	if (StringBytes( str, &bytes, &length )) {
+		return str;
+	}
+	const char *data = UnpackString( zone, str );
+	if (!data) {
+		return ThrowCStr( zone, "expected a string" );
+	}
+	value_t out = StringFromUTF8Bytes( zone, data, strlen( data ) );
+	free( (void*)data );
+	return out;
+}
+
+static const byte_t *FindBytes(
+		const byte_t *haystack,
+		size_t haystack_length,
+		const byte_t *needle,
+		size_t needle_length )
+{
+	// Single-byte needles are the common case for separators, and memchr
+	// scans for them with vector compares. Longer needles go to memmem, which
+	// runs in linear time with no setup cost (glibc uses the two-way
+	// algorithm, after a vectorized scan for the first byte).
+	if (needle_length > haystack_length) {
+		return NULL;
+	}
+	if (1 == needle_length) {
+		return memchr( haystack, needle[0], haystack_length );
+	}
+	return memmem( haystack, haystack_length, needle, needle_length );
+}
+
+static value_t AppendSlice(
+		zone_t zone, value_t list, value_t str, size_t begin, size_t end )
+{
+	value_t piece = SliceStringBytes( zone, str, begin, end );
+	if (IsAnException( piece )) return piece;
+	return METHOD_1( list, sym_append, piece );
+}
+
+static value_t string_find_function( PREFUNC, value_t str, value_t needle )
+{
+	ARGCHECK_2( str, needle );
+	// Return the index of the first char of the first occurrence of the
+	// needle, or -1 if it does not occur.
+	str = ContiguousString( zone, str );
+	if (IsAnException( str )) return str;
+	needle = ContiguousString( zone, needle );
+	if (IsAnException( needle )) return needle;
+	const byte_t *bytes = NULL, *target = NULL;
+	size_t length = 0, target_length = 0;
+	StringBytes( str, &bytes, &length );
+	StringBytes( needle, &target, &target_length );
+	if (0 == target_length) {
+		return NumberFromInt( zone, 0 );
+	}
+	const byte_t *hit = FindBytes( bytes, length, target, target_length );
+	if (!hit) {
+		return NumberFromInt( zone, -1 );
+	}
+	// Convert the byte offset to a char index. If the string has one char
+	// per byte, they are the same thing.
+	size_t offset = hit - bytes;
+	size_t codepoints = 0;
+	StringCodepoints( str, &codepoints );
+	if (codepoints != length) {
+		offset = CountCodepoints( bytes, offset );
+	}
+	return NumberFromInt( zone, offset );
+}
+const struct closure string_find = {(function_t)string_find_function};
+
+static value_t string_count_function( PREFUNC, value_t str, value_t needle )
+{
+	ARGCHECK_2( str, needle );
+	// Count the non-overlapping occurrences of the needle.
+	str = ContiguousString( zone, str );
+	if (IsAnException( str )) return str;
+	needle = ContiguousString( zone, needle );
+	if (IsAnException( needle )) return needle;
+	const byte_t *bytes = NULL, *target = NULL;
+	size_t length = 0, target_length = 0;
+	StringBytes( str, &bytes, &length );
+	StringBytes( needle, &target, &target_length );
+	if (0 == target_length) {
+		return ThrowCStr( zone, "search string must not be empty" );
+	}
+	size_t count = 0;
+	size_t pos = 0;
+	const byte_t *hit = NULL;
+	while ((hit = FindBytes(
+			&bytes[pos], length - pos, target, target_length ))) {
+		count++;
+		pos = (hit - bytes) + target_length;
+	}
+	return NumberFromInt( zone, count );
+}
+const struct closure string_count = {(function_t)string_count_function};
+
+static value_t string_split_function( PREFUNC, value_t str, value_t sep )
+{
+	ARGCHECK_2( str, sep );
+	// Break the string at each occurrence of the separator, returning a list
+	// of the pieces between them. The separators themselves are dropped. A
+	// string with N separators always yields N + 1 pieces, some of which may
+	// be empty.
+	str = ContiguousString( zone, str );
+	if (IsAnException( str )) return str;
+	sep = ContiguousString( zone, sep );
+	if (IsAnException( sep )) return sep;
+	const byte_t *bytes = NULL, *target = NULL;
+	size_t length = 0, target_length = 0;
+	StringBytes( str, &bytes, &length );
+	StringBytes( sep, &target, &target_length );
+	if (0 == target_length) {
+		return ThrowCStr( zone, "separator must not be empty" );
+	}
+	value_t out = &list_empty;
+	size_t begin = 0;
+	const byte_t *hit = NULL;
+	while ((hit = FindBytes(
+			&bytes[begin], length - begin, target, target_length ))) {
+		size_t end = hit - bytes;
+		out = AppendSlice( zone, out, str, begin, end );
+		if (IsAnException( out )) return out;
+		begin = end + target_length;
+	}
+	return AppendSlice( zone, out, str, begin, length );
+}
+const struct closure string_split = {(function_t)string_split_function};
+
+static value_t string_split_lines_function( PREFUNC, value_t str )
+{
+	ARGCHECK_1( str );
+	// Split a string into lines, respecting all three linebreak conventions
+	// even when they are mixed: LF on its own, as in Unix; CR on its own, as
+	// in the classic Mac OS; and the CR-LF pair, as in Windows. A break at
+	// the very end of the string does not produce an extra blank line, since
+	// that is how a normal text file ends.
+	str = ContiguousString( zone, str );
+	if (IsAnException( str )) return str;
+	const byte_t *bytes = NULL;
+	size_t length = 0;
+	StringBytes( str, &bytes, &length );
+	// Keep track of the next CR and the next LF separately, so that memchr
+	// can scan for each of them a block at a time; we only rescan for one
+	// after we have passed it.
+	const byte_t *end_of_text = bytes + length;
+	const byte_t *next_lf = memchr( bytes, '\n', length );
+	const byte_t *next_cr = memchr( bytes, '\r', length );
+	value_t out = &list_empty;
+	size_t begin = 0;
+	while (next_lf || next_cr) {
+		const byte_t *brk = next_lf;
+		if (next_cr && (!next_lf || next_cr < next_lf)) {
+			brk = next_cr;
+		}
+		size_t end = brk - bytes;
+		size_t after = end + 1;
+		if ('\r' == *brk && after < length && '\n' == bytes[after]) {
+			after++;
+		}
+		out = AppendSlice( zone, out, str, begin, end );
+		if (IsAnException( out )) return out;
+		begin = after;
+		const byte_t *rest = bytes + after;
+		if (next_lf && next_lf < rest) {
+			next_lf = memchr( rest, '\n', end_of_text - rest );
+		}
+		if (next_cr && next_cr < rest) {
+			next_cr = memchr( rest, '\r', end_of_text - rest );
+		}
+	}
+	if (begin < length) {
+		out = AppendSlice( zone, out, str, begin, length );
+	}
+	return out;
+}
+const struct closure string_split_lines =
+		{(function_t)string_split_lines_function};
@@ -0,0 +1,35 @@
+// Copyright 2026 Mars Saxman
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the
+// use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+// claim that you wrote the original software. If you use this software in a
+// product, an acknowledgment in the product documentation would be appreciated
+// but is not required.
+//
+// 2. Altered source versions must be plainly marked as such, and must not be
+// misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+
+
+#ifndef stringsearch_h
+#define stringsearch_h
+
+#include "closures.h"
+
+// Builtin entrypoints for the string library's search functions. Each one
+// works over the string's UTF-8 bytes rather than its boxed chars, and the
+// substrings they return are slices which share the source string's buffer.
+extern const struct closure string_find;
+extern const struct closure string_count;
+extern const struct closure string_split;
+extern const struct closure string_split_lines;
+
+#endif //stringsearch_h
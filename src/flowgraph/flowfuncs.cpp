@@ -14,6 +14,8 @@
 // Radian.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "flowgraph/flowfuncs.h"
+#include "flowgraph/operation.h"
+#include "flowgraph/postorderdfs.h"
 
 using namespace Flowgraph;
 
@@ -26,7 +28,8 @@ Function::Function( Node *exp, unsigned int arity ) :
 	Node(),
 	_exp(exp),
 	_arity(arity),
-	_name(DefaultName())
+	_name(DefaultName()),
+	_cost(Unknown)
 {
 }
 
@@ -34,7 +37,8 @@ Function::Function( Node *exp, unsigned int arity, std::string name ) :
 	Node(),
 	_exp(exp),
 	_arity(arity),
-	_name(name)
+	_name(name),
+	_cost(Unknown)
 {
 }
 
@@ -45,6 +49,29 @@ std::string Function::DefaultName() const
 	return "block_" + numtostr_dec( _arity ) + "_" + UniqueID();
 }
 
+bool Function::IsExpensive()
+{
+	// We can't know how long a function will take without running it, but a
+	// function with no loop in it, which calls nothing that has one, is
+	// unlikely to take long. Functions are created after everything their
+	// bodies refer to, so the references form no cycles, and we can cache the
+	// answer for each one.
+	if (Unknown == _cost) {
+		_cost = Cheap;
+		PostOrderDFS walk( _exp );
+		while (Cheap == _cost && walk.Next()) {
+			Node *item = walk.Current();
+			bool loop = item->IsAnOperation() &&
+					Operation::Type::Loop == item->AsOperation()->Type();
+			if (loop || (item->IsAFunction() &&
+					item->AsFunction()->IsExpensive())) {
+				_cost = Expensive;
+			}
+		}
+	}
+	return Expensive == _cost;
+}
+
 std::string Function::ToString() const
 {
 	NodeFormatter formatter;
@@ -42,6 +42,9 @@ class Function : public Node
 		unsigned int Arity() const { return _arity; }
 		std::string Name() const { return _name; }
 		std::string ToString() const;
+		// Does calling this function run a loop, either directly or through
+		// some other function it refers to?
+		bool IsExpensive();
 	protected:
 		Function( Node *exp, unsigned int arity );
 		Function( Node *exp, unsigned int arity, std::string name );
@@ -51,6 +54,7 @@ class Function : public Node
 		Node *_exp;
 		unsigned int _arity;
 		std::string _name;
+		enum { Unknown, Cheap, Expensive } _cost;
 };
 
 class Parameter : public Node
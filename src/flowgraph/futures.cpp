@@ -0,0 +1,160 @@
+// Copyright 2026 Mars Saxman.
+//
+// Radian is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Radian is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Radian. If not, see <http://www.gnu.org/licenses/>.
+
+#include <vector>
+#include "flowgraph/futures.h"
+#include "flowgraph/flowgraph.h"
+#include "flowgraph/postorderdfs.h"
+
+using namespace Flowgraph;
+
+// The arguments to a call are all evaluated before the call, and since nothing
+// in the language has side effects, the order in which we evaluate them only
+// matters when one depends on another. When two or more of them are calls to
+// functions which look expensive, we can hand all but one of them off to the
+// runtime as futures, evaluate the last one here, then join the futures.
+//
+// A spawned call is replaced by a join whose second argument is the next call
+// in the group: evaluating the first join spawns every future in turn, then
+// computes the last call in place, then collects the results on the way back
+// out. Each call joins at most one group, so the chains never loop. Branches
+// are separate functions, so we never hoist work out of a lazy context.
+
+static const unsigned kMaxFutureArgs = 4;
+
+static Function *Callee( Node *target )
+{
+	// Which function will this call run, if we can tell? A function which
+	// refers to its context is called through a closure, which captures that
+	// context along with the function. We can't tell what a method lookup
+	// will find, so we leave those calls alone.
+	if (target->IsACapture()) {
+		target = target->AsOperation()->Left();
+	}
+	return target->IsAFunction() ? target->AsFunction() : nullptr;
+}
+
+static bool IsExpensiveCall( Node *exp )
+{
+	if (!exp->IsAnOperation() || exp->IsInductionVar()) return false;
+	Operation *op = exp->AsOperation();
+	if (op->Type() != Operation::Type::Call) return false;
+	Function *callee = Callee( op->Left() );
+	if (!callee || !callee->IsExpensive()) return false;
+	unsigned count = 0;
+	for (Node *arg = op->Right(); arg->IsAnArg(); count++) {
+		arg = arg->AsOperation()->Left();
+	}
+	return count > 0 && count <= kMaxFutureArgs;
+}
+
+static bool Contains( Node *exp, Node *target )
+{
+	PostOrderDFS walk( exp );
+	while (walk.Next()) {
+		if (walk.Current() == target) return true;
+	}
+	return false;
+}
+
+class FutureSpawner
+{
+	public:
+		FutureSpawner( Pool &pool ): _pool(pool) {}
+		bool Plan( Node *exp );
+		Node *Apply( Node *exp );
+	private:
+		void PlanCall( Operation *call );
+		Pool &_pool;
+		NodeSet _claimed;
+		NodeMap _next;
+		NodeMap _done;
+};
+
+bool FutureSpawner::Plan( Node *exp )
+{
+	PostOrderDFS walk( exp );
+	while (walk.Next()) {
+		Node *item = walk.Current();
+		if (item->IsAnOperation() &&
+				item->AsOperation()->Type() == Operation::Type::Call) {
+			PlanCall( item->AsOperation() );
+		}
+	}
+	return !_next.empty();
+}
+
+void FutureSpawner::PlanCall( Operation *call )
+{
+	// The arg list is built from the end, so we must walk it backwards.
+	std::vector<Node*> args;
+	for (Node *arg = call->Right(); arg->IsAnArg();) {
+		args.insert( args.begin(), arg->AsOperation()->Right() );
+		arg = arg->AsOperation()->Left();
+	}
+	std::vector<Node*> group;
+	for (Node *arg: args) {
+		if (!IsExpensiveCall( arg ) || _claimed.count( arg )) continue;
+		bool independent = true;
+		for (Node *other: group) {
+			if (Contains( arg, other ) || Contains( other, arg )) {
+				independent = false;
+				break;
+			}
+		}
+		if (independent) {
+			group.push_back( arg );
+		}
+	}
+	if (group.size() < 2) return;
+	for (size_t i = 0; i + 1 < group.size(); i++) {
+		_next[group[i]] = group[i + 1];
+	}
+	_claimed.insert( group.begin(), group.end() );
+}
+
+Node *FutureSpawner::Apply( Node *exp )
+{
+	NodeMap::const_iterator done = _done.find( exp );
+	if (done != _done.end()) {
+		return done->second;
+	}
+	Node *out = exp;
+	NodeMap::const_iterator next = _next.find( exp );
+	if (next != _next.end()) {
+		Operation *call = exp->AsOperation();
+		Node *target = Apply( call->Left() );
+		Node *args = _pool.TupleN( Apply( call->Right() ) );
+		Node *future = _pool.SpawnFuture( target, args );
+		out = _pool.JoinFuture( future, Apply( next->second ) );
+	}
+	else if (exp->IsAnOperation()) {
+		Operation *op = exp->AsOperation();
+		Node *left = Apply( op->Left() );
+		Node *right = Apply( op->Right() );
+		out = _pool.Operation( op->Type(), left, right );
+		if (exp->IsInductionVar() && !op->IsInductionVar()) {
+			out = _pool.Inductor( out );
+		}
+	}
+	_done[exp] = out;
+	return out;
+}
+
+Node *Flowgraph::SpawnFutures( Node *exp, Pool &pool )
+{
+	FutureSpawner spawner( pool );
+	return spawner.Plan( exp ) ? spawner.Apply( exp ) : exp;
+}
@@ -0,0 +1,30 @@
+// Copyright 2026 Mars Saxman.
+//
+// Radian is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 2 of the License, or (at your option) any later
+// version.
+//
+// Radian is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// Radian. If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef flowgraph_futures_h
+#define flowgraph_futures_h
+
+#include "flowgraph/node.h"
+
+namespace Flowgraph {
+
+// Find calls whose arguments include several expensive calls which do not
+// depend on one another, and rewrite all but the last of them as futures, so
+// they can run on other processors while this one computes the last.
+Node *SpawnFutures( Node *exp, class Pool &pool );
+
+}	// namespace Flowgraph
+
+#endif	//futures_h
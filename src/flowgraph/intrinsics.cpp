@@ -26,18 +26,38 @@ std::string Intrinsic::Link() const
 		case ID::Throw: return "throw_exception";
 		case ID::IsNotExceptional: return "is_not_exceptional";
 		case ID::Parallelize: return "parallelize";
+		case ID::Parallel_Reduce: return "parallel_reduce";
+		case ID::Spawn_Future: return "spawn_future";
+		case ID::Join_Future: return "join_future";
+		case ID::Next_Batch: return "next_batch";
+		case ID::Has_Batches: return "has_batches";
 		case ID::Tuple: return "make_tuple";
 		case ID::Map_Blank: return "map_blank";
+		case ID::Record_Blank: return "record_blank";
 		case ID::List: return "list";
 		case ID::List_Blank: return "list_empty";	// named oddly in C code
 		case ID::Loop_Sequencer: return "loop_sequencer";
 		case ID::Loop_Task: return "loop_task";
 		case ID::Char_From_Int: return "char_from_int";
+		case ID::Number_Range: return "number_range";
+		case ID::String_Find: return "string_find";
+		case ID::String_Count: return "string_count";
+		case ID::String_Split: return "string_split";
+		case ID::String_Split_Lines: return "string_split_lines";
+		case ID::String_To_Upper: return "string_to_upper";
+		case ID::String_To_Lower: return "string_to_lower";
+		case ID::String_Fold_Case: return "string_fold_case";
+		case ID::UTF8_Decode: return "utf8_decode";
+		case ID::UTF8_Encode: return "utf8_encode";
+		case ID::UTF16_Decode: return "utf16_decode";
+		case ID::UTF16_Encode: return "utf16_encode";
 		case ID::FFI_Load_External: return "FFI_Load_External";
 		case ID::FFI_Describe_Function: return "FFI_Describe_Function";
 		case ID::FFI_Call: return "FFI_Call";
 		case ID::Read_File: return "Read_File";
 		case ID::Write_File: return "Write_File";
+		case ID::Read_Chunks: return "Read_Chunks";
+		case ID::Byte_Lines: return "byte_lines";
 		case ID::Debug_Trace: return "debug_trace";
         case ID::Sin: return "math_sin";
         case ID::Cos: return "math_cos";
@@ -32,18 +32,38 @@ class Intrinsic : public Node
 			Throw,
 			IsNotExceptional,
 			Parallelize,
+			Parallel_Reduce,
+			Spawn_Future,
+			Join_Future,
+			Next_Batch,
+			Has_Batches,
 			Tuple,
 			Map_Blank,
+			Record_Blank,
 			List,
 			List_Blank,
 			Loop_Sequencer,
 			Loop_Task,
 			Char_From_Int,
+			Number_Range,
+			String_Find,
+			String_Count,
+			String_Split,
+			String_Split_Lines,
+			String_To_Upper,
+			String_To_Lower,
+			String_Fold_Case,
+			UTF8_Decode,
+			UTF8_Encode,
+			UTF16_Decode,
+			UTF16_Encode,
 			FFI_Load_External,
 			FFI_Describe_Function,
 			FFI_Call,
 			Read_File,
 			Write_File,
+			Read_Chunks,
+			Byte_Lines,
 			Debug_Trace,
 
 			Sin,
@@ -71,6 +91,11 @@ class Intrinsic : public Node
 		virtual bool IsContextIndependent() const { return true; }
 		ID::Enum ID() const { return _ID; }
 		std::string Link() const;
+		// The tuple constructor takes any number of arguments, so the caller
+		// spills them into an array and passes its address instead; the
+		// linearizer emits such calls as CallSpill. See function_spill_t in
+		// the runtime's closures.h.
+		bool SpillsArgs() const { return _ID == ID::Tuple; }
 	protected:
 		Intrinsic( unsigned index ) : Node(), _ID((ID::Enum)index) {}
 		void FormatString( NodeFormatter *formatter ) const;
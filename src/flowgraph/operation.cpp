@@ -49,6 +49,8 @@ void Operation::FormatString( NodeFormatter *formatter ) const
 		case Type::Capture: opname = "lambda"; break;
 		case Type::Arg: opname = ""; break;
 		case Type::Loop: opname = "loop"; break;
+		case Type::Assert: opname = "assert"; break;
+		case Type::Chain: opname = "chain"; break;
 		default: assert(false);
 	}
 	if (!opname.empty()) {
@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include "flowgraph/flowgraph.h"
 #include "flowgraph/pool.h"
+#include "flowgraph/futures.h"
 #include "utility/numtostr.h"
 
 using namespace std;
@@ -172,6 +173,7 @@ Node *Pool::Function( Node *exp, unsigned int params )
 	string key = exp->UniqueID() + " " + numtostr_dec( params );
 	Node *out = _functions.Lookup( key );
 	if (!out) {
+		exp = SpawnFutures( exp, *this );
 		out = new Flowgraph::Function( exp, params );
 		_functions.Store( key, out );
 		_callback.PooledFunction( out->AsFunction() );
@@ -182,6 +184,7 @@ Node *Pool::Function( Node *exp, unsigned int params )
 Node *Pool::Function( Node *exp, unsigned int params, string name )
 {
 	CHECK( exp );
+	exp = SpawnFutures( exp, *this );
 	Node *out = _functions.Lookup( name );
 	if (!out) {
 		out = new Flowgraph::Function( exp, params, name );
@@ -580,6 +583,32 @@ Node *Pool::Parallelize( Node *exp )
 	return Call1( Intrinsic( Intrinsic::ID::Parallelize ), exp ); 
 }
 
+Node *Pool::ParallelReduce( Node *exp, Node *method, Node *start )
+{
+	Node *reduce = Intrinsic( Intrinsic::ID::Parallel_Reduce );
+	return Call3( reduce, exp, method, start );
+}
+
+Node *Pool::SpawnFuture( Node *target, Node *args )
+{
+	return Call2( Intrinsic( Intrinsic::ID::Spawn_Future ), target, args );
+}
+
+Node *Pool::JoinFuture( Node *future, Node *after )
+{
+	return Call2( Intrinsic( Intrinsic::ID::Join_Future ), future, after );
+}
+
+Node *Pool::NextBatch( Node *iterator )
+{
+	return Call1( Intrinsic( Intrinsic::ID::Next_Batch ), iterator );
+}
+
+Node *Pool::HasBatches( Node *iterator )
+{
+	return Call1( Intrinsic( Intrinsic::ID::Has_Batches ), iterator );
+}
+
 Node *Pool::IsNotVoid( Node *exp )
 { 
 	return Call1( Intrinsic( Intrinsic::ID::IsNotVoid ), exp ); 
@@ -595,6 +624,11 @@ Node *Pool::MapBlank()
 	return Intrinsic( Intrinsic::ID::Map_Blank ); 
 }
 
+Node *Pool::RecordBlank()
+{
+	return Intrinsic( Intrinsic::ID::Record_Blank );
+}
+
 Node *Pool::List( Node *exp )
 {
 	return Call1( Intrinsic( Intrinsic::ID::List ), exp );
@@ -111,9 +111,15 @@ class Pool
 		Node *Throw( Node *exp );
 		Node *Catch( Node *exp, Node *handler );
 		Node *Parallelize( Node *exp );
+		Node *ParallelReduce( Node *exp, Node *method, Node *start );
+		Node *SpawnFuture( Node *target, Node *args );
+		Node *JoinFuture( Node *future, Node *after );
+		Node *NextBatch( Node *iterator );
+		Node *HasBatches( Node *iterator );
 		Node *IsNotVoid( Node *exp );
 		Node *IsNotExceptional( Node *exp );
 		Node *MapBlank();
+		Node *RecordBlank();
 		Node *List( Node *exp );
 		Node *Dummy();
 		Node *Assert( Node *condition, Node *message );
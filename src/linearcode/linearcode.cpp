@@ -36,6 +36,7 @@ string Op::Name() const
 		"Assert",
 		"Chain",
 		"Call",
+		"CallSpill",
 		"Capture"
 	};
 	assert( _op >= 0 && _op < Code::COUNT );
@@ -118,6 +119,7 @@ TargetOp::TargetOp(
 {
 	assert(
 		op == Code::Call ||
+		op == Code::CallSpill ||
 		op == Code::Capture );
 }
 
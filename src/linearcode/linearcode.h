@@ -47,6 +47,7 @@ class Op
 
 			// Target plus args - TargetOp
 			Call,
+			CallSpill,			// args go in an array; pass count and address
 			Capture,
 
 			COUNT
@@ -195,16 +195,24 @@ void Linearizer::ProcessCall( Operation *op )
 		_current.push(
 				new MonOp( _result, Op::Code::Repeat, tempB ) );
 	} else {
-	// Call anything else: generate a normal call
+	// Call anything else: generate a normal call, unless the target is an
+	// intrinsic which takes any number of arguments. Its backing function is
+	// not variadic; it expects the caller to spill the arguments into an array
+	// and pass their count and the array's address.
 		std::deque<Addr> args;
 		Node *arg = op->Right();
 		while (arg->IsAnArg()) {
 			args.push_front( FindNode( arg->AsOperation()->Right() ) );
 			arg = arg->AsOperation()->Left();
 		}
+		Op::Code::Enum code = Op::Code::Call;
+		if (op->Left()->IsIntrinsic() &&
+				op->Left()->AsIntrinsic()->SpillsArgs()) {
+			code = Op::Code::CallSpill;
+		}
 		_current.push( new TargetOp(
 				_result,
-				Op::Code::Call,
+				code,
 				FindNode( op->Left() ),
 				args ));
 	}
@@ -74,6 +74,16 @@ public:
 	void ImportModule(std::string, std::string, const SourceLocation&) {}
 };
 
+// emit
+//
+// Write out a function's dataflow graph in readable form, so that we can see
+// what the semantic analyzer and the flowgraph transforms made of it.
+//
+static void emit(Flowgraph::Function *func, std::ostream &dest)
+{
+	dest << func->ToString() << std::endl;
+}
+
 static int compile(std::string path, std::ostream &dest)
 {
 	ErrorLog log;
@@ -85,7 +95,7 @@ static int compile(std::string path, std::ostream &dest)
 	ParserStack ast(tokens, log, path);
 	Semantics::Program functions(ast, log, modules, path);
 	while (functions.Next()) {
-		// emit(functions.Current(), dest);
+		emit(functions.Current(), dest);
 	}
 	return log.HasReceivedReport();
 }
@@ -88,14 +88,10 @@ AST::Expression *Core::OptionalExpression(
 //
 bool Core::Next()
 {
-	for (;;) {
+	do {
 		if (!_input.Next()) return false;
-		switch (_input.Current().TokenType()) {
-			case Token::Type::Whitespace:
-			case Token::Type::Comment: continue;
-			default: break;
-		}
-	}
+	} while (_input.Current().TokenType() == Token::Type::Whitespace ||
+			_input.Current().TokenType() == Token::Type::Comment);
 	if (!_startLoc.IsDefined()) {
 		_startLoc = Current().Location();
 	}
@@ -17,6 +17,7 @@
 #include <stack>
 #include <set>
 #include "semantics/blocks/foreach.h"
+#include "flowgraph/postorderdfs.h"
 
 using namespace Semantics;
 using namespace Flowgraph;
@@ -136,12 +137,28 @@ Node *ForLoop::GenerateLoopOperation(
 		}
 	}
 
+	// If we found no mappable subexpressions, and the loop is walking a range
+	// of numbers, there is nothing worth spreading across cores: the range
+	// computes its elements with a single addition. Count through the range
+	// directly instead of walking it with an iterator.
+	Node *rangeMin = _pool.Nil();
+	Node *rangeMax = _pool.Nil();
+	if (mappables.empty() && MatchRange( _sequence, &rangeMin, &rangeMax )) {
+		return GenerateCountedLoop(
+				argTuple, condition, operation, rangeMin, rangeMax );
+	}
+
 	// If we found no mappable subexpressions, it's still worth parallelizing
 	// the original loop. The sequence might do some substantial calculation in
 	// its "current" function, after all.
+	Node *currentFunc = _pool.Call1( _localIterator, _pool.Sym_Current() );
+	Node *currentVal = _pool.Call1( currentFunc, _localIterator );
 	if (mappables.empty()) {
-		argTuple = Parallelize( argTuple, _sequence );
-		return _pool.Loop( argTuple, condition, operation );
+		Node *element = _pool.Inductor( currentVal );
+		Node *start = nullptr;
+		Node *method = MatchReduction( argTuple, bodyExp, element, &start );
+		argTuple = Parallelize( argTuple, _sequence, method, start );
+		return GenerateBatchedLoop( argTuple, condition, operation );
 	}
 
 	// Generate a function which computes these subexpressions based on the
@@ -153,18 +170,12 @@ Node *ForLoop::GenerateLoopOperation(
 	Node *core_map = _pool.Call1( core, _pool.Sym_Map() );
 	Node *newSeq = _pool.Call3( core_map, core, _sequence, mapper );
 
-	// Rewrite the argument tuple so that the loop iterates over the mapped
-	// sequence instead of the original sequence.
-	argTuple = Parallelize( argTuple, newSeq );
-
 	// Rewrite the operation function so that it expects its values to come in
 	// as elements of the tuple our mapper creates. It is not necessary to
 	// rewrite the condition function, because it only cares whether the
 	// sequence is finished; it doesn't care what kind of sequence it receives.
 	NodeMap remap;
 	unsigned index = 0;
-	Node *currentFunc = _pool.Call1( _localIterator, _pool.Sym_Current() );
-	Node *currentVal = _pool.Call1( currentFunc, _localIterator );
 	if (mappables.size() > 1) {
 		// Rewrite each subexpression as a separate dereference from the tuple
 		// returned by the mapping function.
@@ -178,6 +189,12 @@ Node *ForLoop::GenerateLoopOperation(
 		remap[*(mappables.begin())] = currentVal;
 	}
 	bodyExp = Flowgraph::Rewrite( bodyExp, _pool, remap );
+
+	// Rewrite the argument tuple so that the loop iterates over the mapped
+	// sequence instead of the original sequence.
+	Node *start = nullptr;
+	Node *method = MatchReduction( argTuple, bodyExp, currentVal, &start );
+	argTuple = Parallelize( argTuple, newSeq, method, start );
 	unsigned arity = bodyFunc->AsFunction()->Arity();
 	std::string name = bodyFunc->AsFunction()->Name();
 	// We can't reuse a function name. We'll append an "X" to the name to
@@ -189,7 +206,25 @@ Node *ForLoop::GenerateLoopOperation(
 	}
 
 	// We're done rewriting the components, so now we can build a loop.
-    return _pool.Loop( argTuple, condition, operation );
+	return GenerateBatchedLoop( argTuple, condition, operation );
+}
+
+// ForLoop::GenerateSequencerArgs
+//
+// A for loop which yields is a stage in a chain of generators, and whoever
+// consumes it drives the whole chain one element at a time. We hand our input
+// sequence to the parallel engine, just as we do for an ordinary loop, so
+// that a worker can step the upstream stage ahead of us while we work on the
+// elements it has already produced; each stage in the chain does the same for
+// the one before it, so every stage gets a core of its own. A range of
+// numbers costs nothing to step, so there is no point in running it ahead.
+//
+Node *ForLoop::GenerateSequencerArgs( Node *argTuple )
+{
+	Node *rangeMin = _pool.Nil();
+	Node *rangeMax = _pool.Nil();
+	if (MatchRange( _sequence, &rangeMin, &rangeMax )) return argTuple;
+	return Parallelize( argTuple, _sequence, nullptr, nullptr );
 }
 
 void ForLoop::FindMappableSubexpressions( Node *operation, NodeSet *mappables )
@@ -227,16 +262,95 @@ void ForLoop::FindMappableSubexpressions( Node *operation, NodeSet *mappables )
 	}
 }
 
-Node *ForLoop::Parallelize( Node *inputsTuple, Node *inputSequence )
+Node *ForLoop::Parallelize(
+		Node *inputsTuple,
+		Node *inputSequence,
+		Node *reduceMethod,
+		Node *reduceStart )
 {
 	// Parallelize the sequence: that is, wrap it in a dispatcher that will
 	// spread the work across multiple processors, if they are available.
-	// The interface remains that of an ordinary sequence.
-	Node *parallelSequence = _pool.Parallelize( inputSequence );
+	// The interface remains that of an ordinary sequence. The dispatcher
+	// computes elements in blocks, which the loop takes a batch at a time.
+	// If the loop does nothing but fold its elements into an accumulator,
+	// the dispatcher can fold each block down to a single element, and the
+	// loop will only have to combine those.
+	Node *parallelSequence = reduceMethod ?
+			_pool.ParallelReduce( inputSequence, reduceMethod, reduceStart ) :
+			_pool.Parallelize( inputSequence );
 	Node *parIterFunc = _pool.Call1( parallelSequence, _pool.Sym_Iterate() );
 	Node *parallelIterator = _pool.Call1( parIterFunc, parallelSequence );
+	return ReplaceIterator( inputsTuple, parallelIterator );
+}
+
+// ForLoop::MatchReduction
+//
+// Does the loop do nothing but fold each element of its sequence into a
+// single accumulator, using a method we know to be associative? If so, return
+// the method's name, and the accumulator's starting value. The body must
+// produce exactly two values: the next iterator, and the accumulator combined
+// with the current element. Whether the method really is associative depends
+// on the type of the accumulator, which we cannot know until runtime, so the
+// parallel engine checks the starting value before it does any folding.
+//
+Node *ForLoop::MatchReduction(
+		Node *argTuple, Node *bodyExp, Node *element, Node **start )
+{
+	std::vector<Node*> inputs;
+	std::vector<Node*> outputs;
+	if (!UnpackTuple( argTuple, &inputs )) return nullptr;
+	if (!UnpackTuple( bodyExp, &outputs )) return nullptr;
+	if (inputs.size() != 2 || outputs.size() != 2) return nullptr;
+	Node *nextFunc = _pool.Call1( _localIterator, _pool.Sym_Next() );
+	Node *nextVal = _pool.Call1( nextFunc, _localIterator );
+	Node *candidates[] = {
+		_pool.Sym_Add(), _pool.Sym_Multiply(), _pool.Sym_Concatenate()
+	};
+	Node *method = nullptr;
+	for (unsigned index = 0; index < outputs.size(); index++) {
+		Node *var = _pool.Call1( _pool.Parameter(0), _pool.Number( index ) );
+		if (var == _localIterator) {
+			if (outputs[index] != nextVal) return nullptr;
+			continue;
+		}
+		for (Node *candidate: candidates) {
+			Node *func = _pool.Call1( var, candidate );
+			if (outputs[index] == _pool.Call2( func, var, element )) {
+				method = candidate;
+				*start = inputs[index];
+			}
+		}
+	}
+	return method;
+}
 
-	// Rebuild the inputs tuple, replacing the original iterator value.
+// ForLoop::UnpackTuple
+//
+// If this node constructs a tuple, list the values it contains, in order.
+//
+bool ForLoop::UnpackTuple( Node *tuple, std::vector<Node*> *items )
+{
+	if (!tuple->IsAnOperation()) return false;
+	Operation *op = tuple->AsOperation();
+	if (op->Type() != Operation::Type::Call) return false;
+	if (op->Left() != _pool.Intrinsic( Intrinsic::ID::Tuple )) return false;
+	// Remember that args are stored in right-to-left order.
+	items->clear();
+	Node *arg = op->Right();
+	while (arg->IsAnArg()) {
+		items->insert( items->begin(), arg->AsOperation()->Right() );
+		arg = arg->AsOperation()->Left();
+	}
+	return arg->IsVoid();
+}
+
+// ForLoop::ReplaceIterator
+//
+// Rebuild the loop's starting tuple, substituting some other value for the
+// original context iterator.
+//
+Node *ForLoop::ReplaceIterator( Node *inputsTuple, Node *newIterator )
+{
 	assert( inputsTuple->IsAnOperation() );
 	Node *inputsTupleOp = inputsTuple->AsOperation();
 	assert( inputsTupleOp->AsOperation()->Type() == Operation::Type::Call );
@@ -253,7 +367,7 @@ Node *ForLoop::Parallelize( Node *inputsTuple, Node *inputSequence )
 		Node *previous = arg->AsOperation()->Left();
 		Node *value = arg->AsOperation()->Right();
 		if (value == _contextIterator) {
-			arg = _pool.ArgsAppend( previous, parallelIterator );
+			arg = _pool.ArgsAppend( previous, newIterator );
 			break;
 		}
 		trailingArgVals.push(value);
@@ -303,3 +417,253 @@ Node *ForLoop::GenerateMapper( const NodeSet &mappables, Node *captures )
 	}
 	return mapper;
 }
+
+// ForLoop::MatchRange
+//
+// Is the sequence a call to number.range from the standard library? The call
+// looks up the range method on the imported module, then invokes it, passing
+// in the module as self followed by the lower and upper bounds. If it matches,
+// hand back the bound expressions.
+//
+bool ForLoop::MatchRange( Node *sequence, Node **min, Node **max )
+{
+	if (!sequence->IsAnOperation()) return false;
+	Operation *call = sequence->AsOperation();
+	if (call->Type() != Operation::Type::Call) return false;
+	// Remember that args are stored in right-to-left order.
+	Node *args[3];
+	Node *arg = call->Right();
+	for (int i = 2; i >= 0; i--) {
+		if (!arg->IsAnArg()) return false;
+		args[i] = arg->AsOperation()->Right();
+		arg = arg->AsOperation()->Left();
+	}
+	if (!arg->IsVoid() || !args[0]->IsAnImport()) return false;
+	Import *module = args[0]->AsImport();
+	if (module->FileName() != _pool.String( "number" )) return false;
+	if (module->SourceDirectory() != _pool.Sym_Radian()) return false;
+	if (call->Left() != _pool.Call1( module, _pool.Symbol( "range" ) )) {
+		return false;
+	}
+	*min = args[1];
+	*max = args[2];
+	return true;
+}
+
+// ForLoop::GenerateCountedLoop
+//
+// Rewrite a loop over number.range so that it carries the current number in
+// place of the iterator. The loop starts from the lower bound, runs while the
+// number is no greater than the upper bound, and adds one each time around,
+// which is exactly what the range's own iterator would have done, minus the
+// iterator objects and the method calls.
+//
+Node *ForLoop::GenerateCountedLoop(
+		Node *argTuple,
+		Node *condition,
+		Node *operation,
+		Node *min,
+		Node *max )
+{
+	// The condition and operation functions share a list of captured values.
+	// Unless the upper bound is a constant, the condition needs it too, so we
+	// will append it to the list and refer to it through the next slot.
+	Node *captures = _pool.Nil();
+	if (operation->IsACapture()) {
+		captures = operation->AsOperation()->Right();
+	}
+	Node *limit = max;
+	if (!limit->IsContextIndependent()) {
+		unsigned index = 0;
+		for (Node *arg = captures; arg->IsAnArg();
+				arg = arg->AsOperation()->Left()) {
+			index++;
+		}
+		captures = _pool.ArgsAppend( captures, limit );
+		limit = _pool.Slot( index );
+	}
+
+	// Replace each use of the iterator with the equivalent arithmetic on the
+	// number which now occupies its place in the loop tuple.
+	NodeMap remap;
+	Node *value = _localIterator;
+	Node *currentFunc = _pool.Call1( _localIterator, _pool.Sym_Current() );
+	Node *currentVal = _pool.Call1( currentFunc, _localIterator );
+	remap[_pool.Inductor( currentVal )] = value;
+	remap[currentVal] = value;
+	Node *validFunc = _pool.Call1( _localIterator, _pool.Sym_Is_Valid() );
+	Node *validVal = _pool.Call1( validFunc, _localIterator );
+	Node *relation = _pool.Compare( value, limit );
+	remap[validVal] =
+			_pool.Call3( relation, _pool.True(), _pool.True(), _pool.False() );
+	Node *nextFunc = _pool.Call1( _localIterator, _pool.Sym_Next() );
+	Node *nextVal = _pool.Call1( nextFunc, _localIterator );
+	Node *addFunc = _pool.Call1( value, _pool.Sym_Add() );
+	remap[nextVal] = _pool.Call2( addFunc, value, _pool.Number( 1 ) );
+
+	condition = RewriteLoopFunction( condition, captures, remap, "C" );
+	operation = RewriteLoopFunction( operation, captures, remap, "C" );
+	argTuple = ReplaceIterator( argTuple, min );
+	return _pool.Loop( argTuple, condition, operation );
+}
+
+// ForLoop::RewriteLoopFunction
+//
+// Apply a rewrite of the iterator to one of the loop functions, then capture
+// the (possibly extended) list of slot values again. Function names must be
+// unique, so the suffix marks which version of the function this is.
+//
+Node *ForLoop::RewriteLoopFunction(
+		Node *func, Node *captures, NodeMap &remap, std::string suffix )
+{
+	if (func->IsACapture()) {
+		func = func->AsOperation()->Left();
+	}
+	assert( func->IsAFunction() );
+	Function *body = func->AsFunction();
+	Node *exp = Flowgraph::Rewrite( body->Exp(), _pool, remap );
+	Node *out = _pool.Function( exp, body->Arity(), body->Name() + suffix );
+	if (!captures->IsVoid()) {
+		out = _pool.CaptureN( out, captures );
+	}
+	return out;
+}
+
+// ForLoop::GenerateBatchedLoop
+//
+// Build a loop which takes its elements from the iterator a batch at a time.
+// The outer loop carries the iterator, as the original loop did, and asks it
+// for the next batch, which comes back as a tuple of elements, their count,
+// and the iterator positioned after them. An inner loop then runs the body
+// once per element, carrying an index into the batch in place of the
+// iterator: the current element is a tuple lookup, the next one is an add,
+// and no method is sent to any iterator until the batch is used up. The loop
+// only batches if its starting iterator has a next_n method.
+//
+Node *ForLoop::GenerateBatchedLoop(
+		Node *argTuple, Node *condition, Node *operation )
+{
+	// We can only rewrite the loop if the body touches the iterator through
+	// its current, is_valid and next methods; anything else must see a real
+	// iterator.
+	std::vector<Node*> inputs;
+	if (!UnpackTuple( argTuple, &inputs ) ||
+			UsesIteratorDirectly( condition ) ||
+			UsesIteratorDirectly( operation )) {
+		return _pool.Loop( argTuple, condition, operation );
+	}
+
+	// The inner loop functions see the original captures through the same
+	// slots as before, followed by the batch's elements and their count.
+	Node *captures = _pool.Nil();
+	Node *innerCaptures = _pool.Nil();
+	unsigned index = 0;
+	if (operation->IsACapture()) {
+		captures = operation->AsOperation()->Right();
+		for (Node *arg = captures; arg->IsAnArg();
+				arg = arg->AsOperation()->Left()) {
+			innerCaptures = _pool.ArgsAppend(
+					innerCaptures, _pool.Slot( index++ ) );
+		}
+	}
+	Node *batch = _pool.NextBatch( _localIterator );
+	Node *items = _pool.Call1( batch, _pool.Number( 0 ) );
+	Node *count = _pool.Call1( batch, _pool.Number( 1 ) );
+	Node *rest = _pool.Call1( batch, _pool.Number( 2 ) );
+	innerCaptures = _pool.ArgsAppend( innerCaptures, items );
+	innerCaptures = _pool.ArgsAppend( innerCaptures, count );
+	Node *itemsSlot = _pool.Slot( index++ );
+	Node *countSlot = _pool.Slot( index++ );
+
+	// Replace each use of the iterator with the equivalent operation on the
+	// index which now occupies its place in the loop tuple.
+	NodeMap remap;
+	Node *position = _localIterator;
+	Node *currentFunc = _pool.Call1( _localIterator, _pool.Sym_Current() );
+	Node *currentVal = _pool.Call1( currentFunc, _localIterator );
+	Node *element = _pool.Call1( itemsSlot, position );
+	remap[_pool.Inductor( currentVal )] = element;
+	remap[currentVal] = element;
+	Node *validFunc = _pool.Call1( _localIterator, _pool.Sym_Is_Valid() );
+	Node *validVal = _pool.Call1( validFunc, _localIterator );
+	Node *relation = _pool.Compare( position, countSlot );
+	remap[validVal] =
+			_pool.Call3( relation, _pool.True(), _pool.False(), _pool.False() );
+	Node *nextFunc = _pool.Call1( _localIterator, _pool.Sym_Next() );
+	Node *nextVal = _pool.Call1( nextFunc, _localIterator );
+	Node *addFunc = _pool.Call1( position, _pool.Sym_Add() );
+	remap[nextVal] = _pool.Call2( addFunc, position, _pool.Number( 1 ) );
+	Node *innerCondition =
+			RewriteLoopFunction( condition, innerCaptures, remap, "B" );
+	Node *innerOperation =
+			RewriteLoopFunction( operation, innerCaptures, remap, "B" );
+
+	// The outer operation starts the inner loop from the first element of
+	// the batch, then puts the rest of the iterator back in its place.
+	Node *start = _pool.Nil();
+	for (unsigned i = 0; i < inputs.size(); i++) {
+		Node *var = _pool.Call1( _pool.Parameter( 0 ), _pool.Number( i ) );
+		start = _pool.ArgsAppend(
+				start, var == _localIterator ? _pool.Number( 0 ) : var );
+	}
+	Node *inner = _pool.Loop(
+			_pool.TupleN( start ), innerCondition, innerOperation );
+	Node *result = _pool.Nil();
+	for (unsigned i = 0; i < inputs.size(); i++) {
+		Node *var = _pool.Call1( _pool.Parameter( 0 ), _pool.Number( i ) );
+		Node *val = _pool.Call1( inner, _pool.Number( i ) );
+		result = _pool.ArgsAppend( result, var == _localIterator ? rest : val );
+	}
+	Node *bodyFunc = operation;
+	if (bodyFunc->IsACapture()) {
+		bodyFunc = bodyFunc->AsOperation()->Left();
+	}
+	std::string name = bodyFunc->AsFunction()->Name() + "N";
+	Node *outer = _pool.Function( _pool.TupleN( result ), 1, name );
+	if (!captures->IsVoid()) {
+		outer = _pool.CaptureN( outer, captures );
+	}
+
+	// An iterator without next_n would hand over one element per batch, which
+	// costs more than stepping it directly, so we ask the starting iterator
+	// once, before the loop begins, and run the original operation if it
+	// cannot do better. Both operations are closures, which cost nothing to
+	// build; the loop calls whichever one the branch picks.
+	Node *iterator = _pool.Nil();
+	for (unsigned i = 0; i < inputs.size(); i++) {
+		Node *var = _pool.Call1( _pool.Parameter( 0 ), _pool.Number( i ) );
+		if (var == _localIterator) iterator = inputs[i];
+	}
+	assert( !iterator->IsVoid() );
+	Node *hasBatches = _pool.HasBatches( iterator );
+	Node *chosen = _pool.Branch( hasBatches, outer, operation );
+	return _pool.Loop( argTuple, condition, chosen );
+}
+
+// ForLoop::UsesIteratorDirectly
+//
+// Does this loop function do anything with the iterator other than ask for
+// its current element, check whether it is valid, or step to the next one?
+//
+bool ForLoop::UsesIteratorDirectly( Node *func )
+{
+	if (func->IsACapture()) {
+		func = func->AsOperation()->Left();
+	}
+	assert( func->IsAFunction() );
+	NodeMap remap;
+	Node *currentFunc = _pool.Call1( _localIterator, _pool.Sym_Current() );
+	Node *currentVal = _pool.Call1( currentFunc, _localIterator );
+	Node *validFunc = _pool.Call1( _localIterator, _pool.Sym_Is_Valid() );
+	Node *nextFunc = _pool.Call1( _localIterator, _pool.Sym_Next() );
+	remap[_pool.Inductor( currentVal )] = _pool.Nil();
+	remap[currentVal] = _pool.Nil();
+	remap[_pool.Call1( validFunc, _localIterator )] = _pool.Nil();
+	remap[_pool.Call1( nextFunc, _localIterator )] = _pool.Nil();
+	Node *exp = Flowgraph::Rewrite( func->AsFunction()->Exp(), _pool, remap );
+	PostOrderDFS nodes( exp );
+	while (nodes.Next()) {
+		if (nodes.Current() == _localIterator) return true;
+	}
+	return false;
+}
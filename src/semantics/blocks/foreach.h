@@ -16,6 +16,7 @@
 #ifndef semantics_blocks_foreach_h
 #define semantics_blocks_foreach_h
 
+#include <vector>
 #include "semantics/blocks/loops.h"
 
 namespace Semantics {
@@ -38,11 +39,45 @@ class ForLoop : public Loop
                 Flowgraph::Node *argTuple,
                 Flowgraph::Node *condition,
                 Flowgraph::Node *operation );
+        Flowgraph::Node *GenerateSequencerArgs( Flowgraph::Node *argTuple );
         void FindMappableSubexpressions(
                 Flowgraph::Node *operation,
                 Flowgraph::NodeSet *mappables );
         Flowgraph::Node *Parallelize(
-                Flowgraph::Node *argTuple, Flowgraph::Node *inputSequence);
+                Flowgraph::Node *argTuple,
+                Flowgraph::Node *inputSequence,
+                Flowgraph::Node *reduceMethod,
+                Flowgraph::Node *reduceStart );
+        Flowgraph::Node *MatchReduction(
+                Flowgraph::Node *argTuple,
+                Flowgraph::Node *bodyExp,
+                Flowgraph::Node *element,
+                Flowgraph::Node **start );
+        bool UnpackTuple(
+                Flowgraph::Node *tuple,
+                std::vector<Flowgraph::Node*> *items );
+        Flowgraph::Node *ReplaceIterator(
+                Flowgraph::Node *argTuple, Flowgraph::Node *newIterator );
+        bool MatchRange(
+                Flowgraph::Node *sequence,
+                Flowgraph::Node **min,
+                Flowgraph::Node **max );
+        Flowgraph::Node *GenerateCountedLoop(
+                Flowgraph::Node *argTuple,
+                Flowgraph::Node *condition,
+                Flowgraph::Node *operation,
+                Flowgraph::Node *min,
+                Flowgraph::Node *max );
+        Flowgraph::Node *GenerateBatchedLoop(
+                Flowgraph::Node *argTuple,
+                Flowgraph::Node *condition,
+                Flowgraph::Node *operation );
+        bool UsesIteratorDirectly( Flowgraph::Node *func );
+        Flowgraph::Node *RewriteLoopFunction(
+                Flowgraph::Node *func,
+                Flowgraph::Node *captures,
+                Flowgraph::NodeMap &remap,
+                std::string suffix );
         Flowgraph::Node *GenerateMapper(
                 const Flowgraph::NodeSet &mappables,
                 Flowgraph::Node *captures);
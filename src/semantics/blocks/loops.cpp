@@ -50,6 +50,11 @@ Node *Loop::ExitBlock( const SourceLocation &loc )
 	Node *argTuple = StartArgs();
 	Node *result = _pool.Nil();
 	if (async) {
+		// A loop which yields is one stage of a generator; a subclass may
+		// want to arrange its inputs so the stages can overlap.
+		if (!syncup) {
+			argTuple = GenerateSequencerArgs( argTuple );
+		}
 		Node *loop = syncup ? 
 				_pool.Loop_Task( condition, operation, argTuple ):
 				_pool.Loop_Sequencer( condition, operation, argTuple );
@@ -41,6 +41,8 @@ class Loop : public Block
                 Flowgraph::Node *argTuple,
                 Flowgraph::Node *condition,
                 Flowgraph::Node *operation );
+        virtual Flowgraph::Node *GenerateSequencerArgs(
+                Flowgraph::Node *argTuple ) { return argTuple; }
         virtual void ApplyParameterMapping(
                 Flowgraph::Node *key,
                 Flowgraph::Node *oldValue,
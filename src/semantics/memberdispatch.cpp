@@ -21,16 +21,17 @@ using namespace std;
 
 MemberDispatch::MemberDispatch( Pool &pool ):
 	_pool(pool),
-	_members(_pool.MapBlank()),
+	_members(_pool.RecordBlank()),
 	_anyMembersDefined(false)
 {
 }
 
 // MemberDispatch::SetPrototype
 //
-// The member map defaults to a blank map, but you can define something else
+// The member map defaults to a blank record, but you can define something else
 // instead. This is how inheritance works: you start with some existing members,
-// then add new ones (and possibly override old ones). 
+// then add new ones (and possibly override old ones). The inherited index may
+// be a record or a general map; either one accepts the same insert calls.
 //
 void MemberDispatch::SetPrototype( Node *prototype )
 {
@@ -89,12 +89,27 @@ void ModuleRoot::EnableBuiltins(void)
 	BuiltinDef( "map_blank", Intrinsic::ID::Map_Blank );
 	BuiltinDef( "list_blank", Intrinsic::ID::List_Blank );
 	BuiltinFunction( "char_from_int", Intrinsic::ID::Char_From_Int );
+	BuiltinFunction( "number_range", Intrinsic::ID::Number_Range );
+	BuiltinFunction( "string_find", Intrinsic::ID::String_Find );
+	BuiltinFunction( "string_count", Intrinsic::ID::String_Count );
+	BuiltinFunction( "string_split", Intrinsic::ID::String_Split );
+	BuiltinFunction(
+			"string_split_lines", Intrinsic::ID::String_Split_Lines );
+	BuiltinFunction( "string_to_upper", Intrinsic::ID::String_To_Upper );
+	BuiltinFunction( "string_to_lower", Intrinsic::ID::String_To_Lower );
+	BuiltinFunction( "string_fold_case", Intrinsic::ID::String_Fold_Case );
+	BuiltinFunction( "utf8_decode", Intrinsic::ID::UTF8_Decode );
+	BuiltinFunction( "utf8_encode", Intrinsic::ID::UTF8_Encode );
+	BuiltinFunction( "utf16_decode", Intrinsic::ID::UTF16_Decode );
+	BuiltinFunction( "utf16_encode", Intrinsic::ID::UTF16_Encode );
 	BuiltinFunction( "ffi_load_external", Intrinsic::ID::FFI_Load_External );
 	BuiltinFunction(
 			"ffi_describe_function", Intrinsic::ID::FFI_Describe_Function );
 	BuiltinFunction( "ffi_call", Intrinsic::ID::FFI_Call );
 	BuiltinFunction( "read_bytes", Intrinsic::ID::Read_File );
 	BuiltinFunction( "write_bytes", Intrinsic::ID::Write_File );
+	BuiltinFunction( "read_chunks", Intrinsic::ID::Read_Chunks );
+	BuiltinFunction( "byte_lines", Intrinsic::ID::Byte_Lines );
 	BuiltinFunction( "sin", Intrinsic::ID::Sin );
 	BuiltinFunction( "cos", Intrinsic::ID::Cos );
 	BuiltinFunction( "tan", Intrinsic::ID::Tan );
@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+# unicode/casetables.py: build the runtime's case mapping tables.
+#
+# Reads the case mapping modules in library/ and writes runtime/casetables.h,
+# a two-stage lookup table shared by the runtime's case mapping builtins and
+# the compiler's identifier case folding. Run it from the top of the tree
+# whenever the mapping modules change.
+
+import re
+
+BLOCK_BITS = 7
+BLOCK_SIZE = 1 << BLOCK_BITS
+MAPS = ("upper", "lower", "foldcase")
+
+ENTRY = re.compile(r'(0x[0-9a-fA-F]+)\s*=>\s*"([^"]*)"')
+ESCAPE = re.compile(r'\\x([0-9a-fA-F]{2})|\\u([0-9a-fA-F]{4})|'
+		r'\\U([0-9a-fA-F]{6})')
+
+def read_map(name):
+	out = {}
+	with open("library/_%smap.radian" % name) as src:
+		for key, value in ENTRY.findall(src.read()):
+			chars = [int("".join(m), 16) for m in ESCAPE.findall(value)]
+			assert 1 <= len(chars) <= 3
+			out[int(key, 16)] = chars
+	return out
+
+maps = dict((name, read_map(name)) for name in MAPS)
+limit = max(max(m) for m in maps.values()) + 1
+limit = (limit + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1)
+
+# Every distinct output sequence gets one row; row zero means "unchanged".
+mappings = [(0, 0, 0)]
+mapping_index = {(0, 0, 0): 0}
+# Blocks of BLOCK_SIZE row indexes are shared between maps and between
+# ranges of the same map; block zero is the identity block.
+blocks = [tuple([0] * BLOCK_SIZE)]
+block_index = {blocks[0]: 0}
+stage1 = {}
+for name in MAPS:
+	table = maps[name]
+	stage1[name] = []
+	for base in range(0, limit, BLOCK_SIZE):
+		block = []
+		for ch in range(base, base + BLOCK_SIZE):
+			row = tuple((table.get(ch, []) + [0, 0, 0])[:3])
+			if row not in mapping_index:
+				mapping_index[row] = len(mappings)
+				mappings.append(row)
+			block.append(mapping_index[row])
+		block = tuple(block)
+		if block not in block_index:
+			block_index[block] = len(blocks)
+			blocks.append(block)
+		stage1[name].append(block_index[block])
+
+assert len(mappings) < 0x10000 and len(blocks) < 0x10000
+
+def rows(values, per_line, fmt):
+	items = [fmt % v for v in values]
+	for i in range(0, len(items), per_line):
+		yield "\t" + ", ".join(items[i:i + per_line]) + ","
+
+HEADER = """\
+// runtime/casetables.h: generated by unicode/casetables.py from the
+// case mapping modules in library/. Do not edit by hand.
+
+#ifndef casetables_h
+#define casetables_h
+
+#include <stdint.h>
+
+#define CASE_BLOCK_BITS %d
+#define CASE_BLOCK_MASK ((1 << CASE_BLOCK_BITS) - 1)
+#define CASE_TABLE_LIMIT 0x%X
+"""
+
+FOOTER = """\
+// Look up the chars a codepoint maps to, using one of the stage 1 tables
+// above. Returns NULL if the mapping leaves the char unchanged; otherwise
+// the result holds up to three chars, with unused entries set to zero.
+static inline const uint32_t *CaseMapping(
+\t\tconst uint16_t *stage1, uint32_t ch )
+{
+\tif (ch >= CASE_TABLE_LIMIT) return 0;
+\tunsigned block = stage1[ch >> CASE_BLOCK_BITS];
+\tunsigned row = case_blocks[block][ch & CASE_BLOCK_MASK];
+\treturn row ? case_mappings[row] : 0;
+}
+
+#endif //casetables_h
+"""
+
+out = [HEADER % (BLOCK_BITS, limit)]
+for name in MAPS:
+	out.append("static const uint16_t case_stage1_%s[] = {" % name)
+	out.extend(rows(stage1[name], 12, "%d"))
+	out.append("};")
+	out.append("")
+out.append("static const uint16_t case_blocks[][1 << CASE_BLOCK_BITS] = {")
+for block in blocks:
+	out.append("\t{")
+	out.extend("\t" + r for r in rows(block, 12, "%d"))
+	out.append("\t},")
+out.append("};")
+out.append("")
+out.append("static const uint32_t case_mappings[][3] = {")
+out.extend(rows(mappings, 2, "{0x%04X, 0x%04X, 0x%04X}"))
+out.append("};")
+out.append("")
+out.append(FOOTER)
+
+with open("runtime/casetables.h", "w") as dest:
+	dest.write("\n".join(out))
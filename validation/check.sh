@@ -9,7 +9,7 @@ testdir=$2
 tests=$(find $testdir -type f -name "*.radian")
 error=0
 for test in $tests; do
-	if $radian $test; then
+	if $radian $test > /dev/null; then
 		echo -n "."
 	else
 		error=1
@@ -0,0 +1,49 @@
+#!/usr/bin/env bash
+# Script to check the dataflow graphs the compiler produces
+# expects $1 to contain path to radian executable
+# expects to find test files in $2/*.radian
+#
+# Each test file lists patterns, one per comment line, which the compiler's
+# output must contain ("# expect: pattern") or must not contain
+# ("# reject: pattern"). Patterns are extended regular expressions matched
+# against single lines of output.
+
+radian=$1
+testdir=$2
+
+tests=$(find $testdir -type f -name "*.radian")
+error=0
+for test in $tests; do
+	output=$($radian $test)
+	if [ $? != 0 ]; then
+		error=1
+		echo ""
+		echo "Failed: $test"
+		continue
+	fi
+	failed=0
+	while read -r pattern; do
+		if ! grep -qE -- "$pattern" <<< "$output"; then
+			failed=1
+			echo ""
+			echo "Failed: $test: missing $pattern"
+		fi
+	done < <(sed -n 's/^# expect: //p' $test)
+	while read -r pattern; do
+		if grep -qE -- "$pattern" <<< "$output"; then
+			failed=1
+			echo ""
+			echo "Failed: $test: found $pattern"
+		fi
+	done < <(sed -n 's/^# reject: //p' $test)
+	if [ "$failed" = "0" ]; then
+		echo -n "."
+	else
+		error=1
+	fi
+done
+echo ""
+if [ "$error" = "0" ]; then
+	echo "Lowering checks passed."
+fi
+exit $error